@@ -0,0 +1,10 @@
+#-------------------------------------------------
+#
+# dbframework benchmarks
+#
+#-------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += readers \
+    sqlite
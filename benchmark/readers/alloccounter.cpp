@@ -0,0 +1,64 @@
+#include "alloccounter.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Every block is prefixed with its size, aligned for any fundamental type.
+const size_t headerSize = 16;
+
+size_t allocationCount = 0;
+size_t allocatedBytes = 0;
+size_t allocatedPeak = 0;
+
+void* allocate(size_t size)
+{
+    void* p = std::malloc(size + headerSize);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    *static_cast<size_t*>(p) = size;
+    ++allocationCount;
+    allocatedBytes += size;
+    if (allocatedBytes > allocatedPeak)
+        allocatedPeak = allocatedBytes;
+    return static_cast<char*>(p) + headerSize;
+}
+
+void deallocate(void* p)
+{
+    if (p == nullptr)
+        return;
+    void* block = static_cast<char*>(p) - headerSize;
+    allocatedBytes -= *static_cast<size_t*>(block);
+    std::free(block);
+}
+
+}
+
+void* operator new(size_t size) {return allocate(size);}
+void* operator new[](size_t size) {return allocate(size);}
+void operator delete(void* p) noexcept {deallocate(p);}
+void operator delete[](void* p) noexcept {deallocate(p);}
+void operator delete(void* p, size_t) noexcept {deallocate(p);}
+void operator delete[](void* p, size_t) noexcept {deallocate(p);}
+
+void AllocCounter::reset()
+{
+    allocationCount = 0;
+    allocatedPeak = allocatedBytes;
+}
+
+size_t AllocCounter::allocations()
+{
+    return allocationCount;
+}
+
+size_t AllocCounter::currentBytes()
+{
+    return allocatedBytes;
+}
+
+size_t AllocCounter::peakBytes()
+{
+    return allocatedPeak;
+}
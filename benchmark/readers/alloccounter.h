@@ -0,0 +1,17 @@
+#ifndef ALLOCCOUNTER_H
+#define ALLOCCOUNTER_H
+
+#include <cstddef>
+
+// Counts heap allocations made through global operator new. Replacing operators
+// are defined in alloccounter.cpp, so linking it into the program is enough.
+class AllocCounter {
+public:
+    // Resets allocation counter and sets peak to the current number of allocated bytes.
+    static void reset();
+    static size_t allocations();
+    static size_t currentBytes();
+    static size_t peakBytes();
+};
+
+#endif // ALLOCCOUNTER_H
@@ -0,0 +1,133 @@
+#include "benchreaders.h"
+
+int MemColumns::indexOf(MemDataset& ds, const std::string& name) const
+{
+    return ds.columnIndex(name);
+}
+
+Reader2Row::Reader2Row() : DBReader2Object<MemDataset, BenchRow>()
+{
+    colMasterId = columns.add("master_id");
+    colMasterName = columns.add("master_name");
+    colDetailId = columns.add("detail_id");
+    colValue = columns.add("value");
+    colDetailText = columns.add("detail_text");
+}
+
+void Reader2Row::begin(MemDataset& ds)
+{
+    columns.resolve(ds);
+}
+
+bool Reader2Row::read(MemDataset& ds)
+{
+    m_object->masterId = ds.intValue(columns[colMasterId]);
+    m_object->masterName = ds.stringValue(columns[colMasterName]);
+    m_object->detailId = ds.intValue(columns[colDetailId]);
+    m_object->value = ds.isNull(columns[colValue]) ? 0 : ds.doubleValue(columns[colValue]);
+    if (ds.isNull(columns[colDetailText]))
+        m_object->detailText.clear();
+    else
+        m_object->detailText = ds.stringValue(columns[colDetailText]);
+    return true;
+}
+
+Reader2Master::Reader2Master() : DBReader2Object<MemDataset, BenchMaster>()
+{
+    colMasterId = columns.add("master_id");
+    colMasterName = columns.add("master_name");
+    colDetailId = columns.add("detail_id");
+    colValue = columns.add("value");
+    colDetailText = columns.add("detail_text");
+}
+
+void Reader2Master::begin(MemDataset& ds)
+{
+    columns.resolve(ds);
+}
+
+bool Reader2Master::read(MemDataset& ds)
+{
+    if (m_object->details.empty()) {
+        m_object->id = ds.intValue(columns[colMasterId]);
+        m_object->name = ds.stringValue(columns[colMasterName]);
+    }
+
+    m_object->details.emplace_back();
+    BenchDetail& d = m_object->details.back();
+    d.id = ds.intValue(columns[colDetailId]);
+    d.value = ds.isNull(columns[colValue]) ? 0 : ds.doubleValue(columns[colValue]);
+    if (!ds.isNull(columns[colDetailText]))
+        d.text = ds.stringValue(columns[colDetailText]);
+    return true;
+}
+
+Reader2Detail::Reader2Detail() : DBReader2Object<MemDataset, BenchDetail>()
+{
+    colDetailId = columns.add("detail_id");
+    colValue = columns.add("value");
+    colDetailText = columns.add("detail_text");
+}
+
+void Reader2Detail::begin(MemDataset& ds)
+{
+    columns.resolve(ds);
+}
+
+bool Reader2Detail::read(MemDataset& ds)
+{
+    m_object->id = ds.intValue(columns[colDetailId]);
+    m_object->value = ds.isNull(columns[colValue]) ? 0 : ds.doubleValue(columns[colValue]);
+    if (ds.isNull(columns[colDetailText]))
+        m_object->text.clear();
+    else
+        m_object->text = ds.stringValue(columns[colDetailText]);
+    return true;
+}
+
+Reader2MasterDetail::Reader2MasterDetail() : DBReader2Object<MemDataset, BenchMaster>()
+{
+    colMasterId = columns.add("master_id");
+    colMasterName = columns.add("master_name");
+    readDetails.setReader(&readDetail);
+    readDetails.setRecycle(true);
+}
+
+void Reader2MasterDetail::begin(MemDataset& ds)
+{
+    columns.resolve(ds);
+    readDetails.begin(ds);
+}
+
+void Reader2MasterDetail::end(MemDataset& ds, bool ok)
+{
+    readDetails.end(ds, ok);
+}
+
+bool Reader2MasterDetail::read(MemDataset& ds)
+{
+    m_object->id = ds.intValue(columns[colMasterId]);
+    m_object->name = ds.stringValue(columns[colMasterName]);
+    readDetails.setContainer(&m_object->details);
+    return readDetails.read(ds);
+}
+
+StaticReader2Row::StaticReader2Row() : DBStaticReader2Object<StaticReader2Row, MemDataset, BenchRow>()
+{
+    colMasterId = columns.add("master_id");
+    colMasterName = columns.add("master_name");
+    colDetailId = columns.add("detail_id");
+    colValue = columns.add("value");
+    colDetailText = columns.add("detail_text");
+}
+
+void Reader2MasterKey::begin(MemDataset& ds)
+{
+    index = ds.columnIndex("master_id");
+}
+
+bool Reader2MasterKey::read(MemDataset& ds)
+{
+    *m_object = ds.intValue(index);
+    return true;
+}
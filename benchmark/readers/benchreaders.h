@@ -0,0 +1,137 @@
+#ifndef BENCHREADERS_H
+#define BENCHREADERS_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "dbframework.h"
+#include "memdataset.h"
+
+class BenchRow {
+public:
+    int masterId;
+    std::string masterName;
+    int detailId;
+    double value;
+    std::string detailText;
+};
+
+typedef std::shared_ptr<BenchRow> BenchRowPtr;
+
+class BenchDetail {
+public:
+    int id;
+    double value;
+    std::string text;
+};
+
+class BenchMaster {
+public:
+    int id;
+    std::string name;
+    std::vector<BenchDetail> details;
+};
+
+typedef std::shared_ptr<BenchMaster> BenchMasterPtr;
+
+class MemColumns : public dbframework::DBColumns<MemDataset, std::string, int> {
+protected:
+    int indexOf(MemDataset& ds, const std::string& name) const;
+};
+
+// Reads every row of the result as a flat object.
+class Reader2Row : public dbframework::DBReader2Object<MemDataset, BenchRow> {
+private:
+    MemColumns columns;
+    int colMasterId;
+    int colMasterName;
+    int colDetailId;
+    int colValue;
+    int colDetailText;
+public:
+    Reader2Row();
+    void begin(MemDataset& ds);
+    bool read(MemDataset& ds);
+};
+
+// Reads master fields and appends the detail of the row to the master.
+class Reader2Master : public dbframework::DBReader2Object<MemDataset, BenchMaster> {
+private:
+    MemColumns columns;
+    int colMasterId;
+    int colMasterName;
+    int colDetailId;
+    int colValue;
+    int colDetailText;
+public:
+    Reader2Master();
+    void begin(MemDataset& ds);
+    bool read(MemDataset& ds);
+};
+
+// Reads detail fields of the row.
+class Reader2Detail : public dbframework::DBReader2Object<MemDataset, BenchDetail> {
+private:
+    MemColumns columns;
+    int colDetailId;
+    int colValue;
+    int colDetailText;
+public:
+    Reader2Detail();
+    void begin(MemDataset& ds);
+    bool read(MemDataset& ds);
+};
+
+// Reads master fields and the detail of the row to the master's details with
+// the recycling nested reader, so every row is a master with one detail.
+class Reader2MasterDetail : public dbframework::DBReader2Object<MemDataset, BenchMaster> {
+private:
+    MemColumns columns;
+    int colMasterId;
+    int colMasterName;
+    Reader2Detail readDetail;
+    dbframework::DBReader2STLContainer<MemDataset, BenchDetail, std::vector<BenchDetail> > readDetails;
+public:
+    Reader2MasterDetail();
+    void begin(MemDataset& ds);
+    void end(MemDataset& ds, bool ok);
+    bool read(MemDataset& ds);
+};
+
+class Reader2MasterKey : public dbframework::DBReader2Object<MemDataset, int> {
+private:
+    int index;
+public:
+    Reader2MasterKey() : DBReader2Object<MemDataset, int>(), index(-1) {};
+    void begin(MemDataset& ds);
+    bool read(MemDataset& ds);
+};
+
+// Static counterpart of Reader2Row. read is defined in the class, so it can be
+// inlined into the static container reader.
+class StaticReader2Row : public dbframework::DBStaticReader2Object<StaticReader2Row, MemDataset, BenchRow> {
+private:
+    MemColumns columns;
+    int colMasterId;
+    int colMasterName;
+    int colDetailId;
+    int colValue;
+    int colDetailText;
+public:
+    StaticReader2Row();
+    void begin(MemDataset& ds) {columns.resolve(ds);};
+    bool read(MemDataset& ds)
+    {
+        m_object->masterId = ds.intValue(columns[colMasterId]);
+        m_object->masterName = ds.stringValue(columns[colMasterName]);
+        m_object->detailId = ds.intValue(columns[colDetailId]);
+        m_object->value = ds.isNull(columns[colValue]) ? 0 : ds.doubleValue(columns[colValue]);
+        if (ds.isNull(columns[colDetailText]))
+            m_object->detailText.clear();
+        else
+            m_object->detailText = ds.stringValue(columns[colDetailText]);
+        return true;
+    };
+};
+
+#endif // BENCHREADERS_H
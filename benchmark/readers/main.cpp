@@ -0,0 +1,231 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "dbframework.h"
+#include "alloccounter.h"
+#include "benchreaders.h"
+#include "memdataset.h"
+
+using namespace std;
+using namespace dbframework;
+
+class BenchResult {
+public:
+    string name;
+    size_t rows;
+    double seconds;
+    size_t allocations;
+    size_t peakBytes;
+    bool ok;
+};
+
+MemSQLExec executor;
+
+// Runs the benchmark repeat times with a new container every time. The best time
+// is reported. Allocations and peak memory are measured during reading only.
+template <class Container, class Run>
+void bench(vector<BenchResult>& results, const string& name, MemDataset& ds, int repeat, Run run)
+{
+    BenchResult r;
+    r.name = name;
+    r.rows = ds.rowCount();
+    r.seconds = 0;
+    r.allocations = 0;
+    r.peakBytes = 0;
+    r.ok = true;
+
+    for (int i = 0; i < repeat; ++i) {
+        unique_ptr<Container> c(new Container);
+        size_t base = AllocCounter::currentBytes();
+        AllocCounter::reset();
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        r.ok = run(*c) && r.ok;
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if ((i == 0) || (seconds < r.seconds))
+            r.seconds = seconds;
+        r.allocations = AllocCounter::allocations();
+        r.peakBytes = AllocCounter::peakBytes() - base;
+    }
+    results.push_back(r);
+}
+
+// Returns zero instead of inf or NaN for the case too fast for the clock or the empty result.
+double safeDivide(double value, double divisor)
+{
+    return (divisor > 0) ? value / divisor : 0;
+}
+
+void printResults(const vector<BenchResult>& results, bool csv)
+{
+    if (csv) {
+        cout << "reader,rows,seconds,rows_per_sec,allocs_per_row,peak_bytes,ok" << endl;
+        for (auto i = results.begin(); i != results.end(); ++i) {
+            cout << i->name << ',' << i->rows << ',' << i->seconds << ',' << safeDivide(i->rows, i->seconds) << ','
+                 << safeDivide(i->allocations, i->rows) << ',' << i->peakBytes << ',' << i->ok << endl;
+        }
+        return;
+    }
+    cout << left << setw(40) << "reader" << right << setw(12) << "rows" << setw(14) << "rows/sec"
+         << setw(12) << "allocs/row" << setw(12) << "peak MB" << endl;
+    for (auto i = results.begin(); i != results.end(); ++i) {
+        cout << left << setw(40) << i->name << right << setw(12) << i->rows << setw(14) << fixed << setprecision(0)
+             << safeDivide(i->rows, i->seconds) << setw(12) << setprecision(2) << safeDivide(i->allocations, i->rows)
+             << setw(12) << i->peakBytes / (1024.0 * 1024.0) << (i->ok ? "" : "  FAILED") << endl;
+    }
+}
+
+void printUsage()
+{
+    cout << "Usage: readers [--masters N] [--fanout N] [--width N] [--nulls RATE] [--shuffled] [--repeat N] [--csv]" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    MemDatasetConfig config;
+    int repeat = 3;
+    bool csv = false;
+
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if ((strcmp(argv[i], "--masters") == 0) && hasValue)
+            config.masters = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--fanout") == 0) && hasValue)
+            config.fanout = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--width") == 0) && hasValue)
+            config.stringWidth = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--nulls") == 0) && hasValue)
+            config.nullRate = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--repeat") == 0) && hasValue)
+            repeat = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--shuffled") == 0)
+            config.shuffled = true;
+        else if (strcmp(argv[i], "--csv") == 0)
+            csv = true;
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+    if ((config.masters <= 0) || (config.fanout <= 0) || (repeat <= 0)) {
+        printUsage();
+        return 1;
+    }
+
+    MemDataset ds;
+    ds.generate(config);
+    vector<BenchResult> results;
+
+    bench<vector<BenchRow> >(results, "DBReader2STLContainer", ds, repeat, [&ds](vector<BenchRow>& c) {
+        Reader2Row rr;
+        DBReader2STLContainer<MemDataset, BenchRow, vector<BenchRow> > r(&c, &rr);
+        return executor.exec(ds, nullptr, &r);
+    });
+    DBRowCountHistory rowHistory;
+    bench<vector<BenchRow> >(results, "DBReader2STLContainer history", ds, repeat, [&ds, &rowHistory](vector<BenchRow>& c) {
+        Reader2Row rr;
+        DBReader2STLContainer<MemDataset, BenchRow, vector<BenchRow> > r(&c, &rr);
+        return executor.exec(ds, nullptr, &r, &rowHistory);
+    });
+    bench<vector<BenchRow> >(results, "DBStaticReader2STLContainer", ds, repeat, [&ds](vector<BenchRow>& c) {
+        StaticReader2Row rr;
+        DBStaticReader2STLContainer<MemDataset, BenchRow, vector<BenchRow>, StaticReader2Row> r(&c, &rr);
+        return executor.execStatic(ds, static_cast<DBStaticBinders<MemDataset>*>(nullptr), &r);
+    });
+    bench<vector<BenchRowPtr> >(results, "DBReader2STLContainerPtr", ds, repeat, [&ds](vector<BenchRowPtr>& c) {
+        Reader2Row rr;
+        DBReader2STLContainerPtr<MemDataset, BenchRow, vector<BenchRowPtr>, BenchRowPtr> r(&c, &rr);
+        return executor.exec(ds, nullptr, &r);
+    });
+    bench<vector<BenchRowPtr> >(results, "DBReader2STLContainerPtr shared", ds, repeat, [&ds](vector<BenchRowPtr>& c) {
+        Reader2Row rr;
+        DBReader2STLContainerPtr<MemDataset, BenchRow, vector<BenchRowPtr>, BenchRowPtr, DBSharedObjectFactory<BenchRow> > r(&c, &rr);
+        return executor.exec(ds, nullptr, &r);
+    });
+    // Recycling readers refresh the same container every run, so the last run shows steady state allocations.
+    vector<BenchRow> recycledRows;
+    bench<vector<BenchRow> >(results, "DBReader2STLContainer recycle", ds, repeat, [&ds, &recycledRows](vector<BenchRow>&) {
+        Reader2Row rr;
+        DBReader2STLContainer<MemDataset, BenchRow, vector<BenchRow> > r(&recycledRows, &rr);
+        r.setRecycle(true);
+        return executor.exec(ds, nullptr, &r);
+    });
+    vector<BenchRowPtr> recycledRowPtrs;
+    bench<vector<BenchRowPtr> >(results, "DBReader2STLContainerPtr recycle", ds, repeat, [&ds, &recycledRowPtrs](vector<BenchRowPtr>&) {
+        Reader2Row rr;
+        DBReader2STLContainerPtr<MemDataset, BenchRow, vector<BenchRowPtr>, BenchRowPtr> r(&recycledRowPtrs, &rr);
+        r.setRecycle(true);
+        return executor.exec(ds, nullptr, &r);
+    });
+    // The masters are stored by value, so the details of the previous master are moved when the container of
+    // masters grows.
+    vector<BenchMaster> recycledMasters;
+    bench<vector<BenchMaster> >(results, "DBReader2STLContainer nested recycle", ds, repeat,
+        [&ds, &recycledMasters](vector<BenchMaster>&) {
+        Reader2MasterDetail rm;
+        DBReader2STLContainer<MemDataset, BenchMaster, vector<BenchMaster> > r(&recycledMasters, &rm);
+        r.setRecycle(true);
+        return executor.exec(ds, nullptr, &r);
+    });
+    typedef map<int, BenchMaster> MasterMap;
+    bench<MasterMap>(results, "DBReader2STLAssociative map", ds, repeat, [&ds](MasterMap& c) {
+        Reader2Master rm;
+        Reader2MasterKey rk;
+        DBReader2STLAssociative<MemDataset, BenchMaster, MasterMap, int> r(&c, &rm, &rk);
+        return executor.exec(ds, nullptr, &r);
+    });
+    typedef unordered_map<int, BenchMaster> MasterHash;
+    bench<MasterHash>(results, "DBReader2STLAssociative unordered_map", ds, repeat, [&ds](MasterHash& c) {
+        Reader2Master rm;
+        Reader2MasterKey rk;
+        DBReader2STLAssociative<MemDataset, BenchMaster, MasterHash, int> r(&c, &rm, &rk);
+        return executor.exec(ds, nullptr, &r);
+    });
+    DBRowCountHistory masterHistory;
+    bench<MasterHash>(results, "DBReader2STLAssociative hash history", ds, repeat, [&ds, &masterHistory](MasterHash& c) {
+        Reader2Master rm;
+        Reader2MasterKey rk;
+        DBReader2STLAssociative<MemDataset, BenchMaster, MasterHash, int> r(&c, &rm, &rk);
+        return executor.exec(ds, nullptr, &r, &masterHistory);
+    });
+    typedef map<int, BenchMasterPtr> MasterPtrMap;
+    bench<MasterPtrMap>(results, "DBReader2STLAssociativePtr map", ds, repeat, [&ds](MasterPtrMap& c) {
+        Reader2Master rm;
+        Reader2MasterKey rk;
+        DBReader2STLAssociativePtr<MemDataset, BenchMaster, MasterPtrMap, int, BenchMasterPtr> r(&c, &rm, &rk);
+        return executor.exec(ds, nullptr, &r);
+    });
+    typedef vector<BenchMasterPtr> MasterVector;
+    bench<MasterVector>(results, "DBReader2IndexedSTLContainerPtr map", ds, repeat, [&ds](MasterVector& c) {
+        Reader2Master rm;
+        Reader2MasterKey rk;
+        DBReader2IndexedSTLContainerPtr<MemDataset, BenchMaster, MasterVector, int, BenchMasterPtr, MasterPtrMap> r(&c, &rm, &rk);
+        return executor.exec(ds, nullptr, &r);
+    });
+    int masters = config.masters;
+    typedef unordered_map<int, BenchMasterPtr> MasterPtrHash;
+    bench<MasterVector>(results, "DBReader2IndexedSTLContainerPtr hash", ds, repeat, [&ds, masters](MasterVector& c) {
+        Reader2Master rm;
+        Reader2MasterKey rk;
+        DBReader2IndexedSTLContainerPtr<MemDataset, BenchMaster, MasterVector, int, BenchMasterPtr, MasterPtrHash> r(&c, &rm, &rk);
+        r.reserveIndex(masters);
+        return executor.exec(ds, nullptr, &r);
+    });
+    if (!config.shuffled) {
+        bench<MasterVector>(results, "DBReader2SortedSTLContainerPtr", ds, repeat, [&ds](MasterVector& c) {
+            Reader2Master rm;
+            Reader2MasterKey rk;
+            DBReader2SortedSTLContainerPtr<MemDataset, BenchMaster, MasterVector, int, BenchMasterPtr> r(&c, &rm, &rk);
+            return executor.exec(ds, nullptr, &r);
+        });
+    }
+
+    printResults(results, csv);
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include "memdataset.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+
+const char* columnNames[MemDataset::ColumnCount] = {"master_id", "master_name", "detail_id", "value", "detail_text"};
+
+std::string randomString(std::mt19937& gen, int width)
+{
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::string s(width, ' ');
+    for (auto i = s.begin(); i != s.end(); ++i)
+        *i = static_cast<char>(letter(gen));
+    return s;
+}
+
+}
+
+void MemDataset::generate(const MemDatasetConfig& config)
+{
+    std::mt19937 gen(config.seed);
+    std::bernoulli_distribution null(config.nullRate);
+    std::uniform_real_distribution<double> value(0, 1000);
+    int detailId = 0;
+
+    rows.clear();
+    rows.reserve(static_cast<size_t>(config.masters) * config.fanout);
+    for (int m = 0; m < config.masters; ++m) {
+        std::string name = randomString(gen, config.stringWidth);
+        for (int d = 0; d < config.fanout; ++d) {
+            MemRow row;
+            row.masterId = m;
+            row.detailId = detailId++;
+            row.masterName = name;
+            row.value = 0;
+            row.nulls = 0;
+            if (null(gen))
+                row.nulls |= 1u << ColValue;
+            else
+                row.value = value(gen);
+            if (null(gen))
+                row.nulls |= 1u << ColDetailText;
+            else
+                row.detailText = randomString(gen, config.stringWidth);
+            rows.push_back(row);
+        }
+    }
+    if (config.shuffled)
+        std::shuffle(rows.begin(), rows.end(), gen);
+    pos = rows.size();
+}
+
+int MemDataset::columnIndex(const std::string& name) const
+{
+    for (int i = 0; i < ColumnCount; ++i) {
+        if (name == columnNames[i])
+            return i;
+    }
+    return -1;
+}
+
+bool MemSQLExec::executeQuery(MemDataset& ds)
+{
+    ds.rewind();
+    return true;
+}
+
+bool MemSQLExec::next(MemDataset& ds)
+{
+    return ds.next();
+}
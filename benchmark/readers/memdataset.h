@@ -0,0 +1,64 @@
+#ifndef MEMDATASET_H
+#define MEMDATASET_H
+
+#include <string>
+#include <vector>
+#include "dbframework.h"
+
+// Shape of the generated SQL query result. Every master has fanout detail rows,
+// so the result looks like "master join detail".
+class MemDatasetConfig {
+public:
+    int masters;
+    int fanout;
+    bool shuffled;     // if false, rows are ordered by master id
+    int stringWidth;
+    double nullRate;   // probability of NULL in nullable columns
+    unsigned seed;
+    MemDatasetConfig() : masters(10000), fanout(10), shuffled(false), stringWidth(16), nullRate(0), seed(1) {};
+};
+
+class MemRow {
+public:
+    int masterId;
+    int detailId;
+    double value;
+    std::string masterName;
+    std::string detailText;
+    unsigned nulls;
+};
+
+// In-memory Dataset. Rows are generated once by generate, so reading them
+// measures only the readers.
+class MemDataset {
+private:
+    std::vector<MemRow> rows;
+    size_t pos;
+public:
+    enum Column {ColMasterId, ColMasterName, ColDetailId, ColValue, ColDetailText, ColumnCount};
+    MemDataset() : pos(0) {};
+    void generate(const MemDatasetConfig& config);
+    size_t rowCount() const {return rows.size();};
+    void rewind() {pos = rows.size();};
+    bool next()
+    {
+        pos = (pos == rows.size()) ? 0 : pos + 1;
+        return pos < rows.size();
+    };
+    int columnIndex(const std::string& name) const;
+    bool isNull(int column) const {return (rows[pos].nulls & (1u << column)) != 0;};
+    int intValue(int column) const {return (column == ColMasterId) ? rows[pos].masterId : rows[pos].detailId;};
+    double doubleValue(int /*column*/) const {return rows[pos].value;};
+    const std::string& stringValue(int column) const
+    {
+        return (column == ColMasterName) ? rows[pos].masterName : rows[pos].detailText;
+    };
+};
+
+class MemSQLExec : public dbframework::DBSQLExecutor<MemDataset> {
+protected:
+    bool executeQuery(MemDataset& ds);
+    bool next(MemDataset& ds);
+};
+
+#endif // MEMDATASET_H
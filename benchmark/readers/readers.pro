@@ -0,0 +1,27 @@
+#-------------------------------------------------
+#
+# Reader templates micro-benchmark over in-memory Dataset
+#
+#-------------------------------------------------
+
+QT       -= core gui
+
+TARGET = readers
+CONFIG   += console c++11
+CONFIG   -= app_bundle qt
+
+TEMPLATE = app
+
+
+SOURCES += main.cpp \
+    memdataset.cpp \
+    alloccounter.cpp \
+    benchreaders.cpp
+
+
+HEADERS += \
+    memdataset.h \
+    alloccounter.h \
+    benchreaders.h
+
+INCLUDEPATH += ../..
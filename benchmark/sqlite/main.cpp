@@ -0,0 +1,403 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "dbframework.h"
+#include "sqlite/dbsqlite.h"
+#include "testtypes.h"
+#include "testschema.h"
+#include "sqlitereaders.h"
+
+using namespace std;
+using namespace dbframework;
+
+// Indexes used by the lookups, created on top of the schema of the example application.
+const char* scriptBenchIndexes[] = {
+    "create index account_ref_customer on account(ref_customer)",
+
+    "create index tran_ref_account on tran(ref_account)",
+
+    nullptr
+};
+
+const char* queryFullInfo = "select c.id as customer_id, c.name as customer_name, \
+    a.id as account_id, a.ref_customer as account_ref_customer, \
+    t.id as tran_id, t.ref_account as tran_ref_account, t.amount as tran_amount \
+    from (customer c left join account a on c.id = a.ref_customer) left join tran t on a.id = t.ref_account";
+
+class BenchConfig {
+public:
+    int customers;
+    int accounts;
+    int trans;
+    int lookups;
+    unsigned seed;
+    string database;
+    string output;
+    BenchConfig() : customers(10000), accounts(20000), trans(100000), lookups(10000), seed(1),
+        database(":memory:"), output("sqlite_bench.json") {};
+};
+
+class BenchResult {
+public:
+    string name;
+    size_t operations;
+    size_t rows;
+    double seconds;
+    bool ok;
+};
+
+class Timer {
+private:
+    chrono::steady_clock::time_point start;
+public:
+    Timer() : start(chrono::steady_clock::now()) {};
+    double seconds() const {return chrono::duration<double>(chrono::steady_clock::now() - start).count();};
+};
+
+DBSqliteExecutor executor;
+
+// Counts records read by the nested reader.
+class CountingReader : public DBReader<DBSqliteStatement> {
+private:
+    DBReader<DBSqliteStatement>* reader;
+public:
+    size_t rows;
+    CountingReader(DBReader<DBSqliteStatement>* r) : DBReader<DBSqliteStatement>(), reader(r), rows(0) {};
+    void begin(DBSqliteStatement& ds) {reader->begin(ds);};
+    void end(DBSqliteStatement& ds, bool ok) {reader->end(ds, ok);};
+    void setRowCountHint(size_t count) {reader->setRowCountHint(count);};
+    size_t resultSize(size_t rows) const {return reader->resultSize(rows);};
+    bool read(DBSqliteStatement& ds)
+    {
+        ++rows;
+        return reader->read(ds);
+    };
+};
+
+BenchResult result(const string& name, size_t operations, size_t rows, const Timer& timer, bool ok)
+{
+    BenchResult r;
+    r.name = name;
+    r.operations = operations;
+    r.rows = rows;
+    r.seconds = timer.seconds();
+    r.ok = ok;
+    return r;
+}
+
+bool execScript(sqlite3* db, const char** script)
+{
+    bool result = true;
+    for (const char** sql = script; result && (*sql != nullptr); ++sql) {
+        DBSqliteStatement st(db, *sql);
+        result = executor.exec(st, nullptr, nullptr);
+    }
+    return result;
+}
+
+bool createSchema(sqlite3* db)
+{
+    return execScript(db, scriptDBCreate) && execScript(db, scriptBenchIndexes);
+}
+
+template <class Object, class Binder>
+BenchResult fill(sqlite3* db, const string& name, const char* sql, vector<Object>& objects)
+{
+    DBSqliteStatement st(db, sql);
+    Binder binder(nullptr);
+    Timer timer;
+    bool ok = executor.execBatch(st, &binder, objects.begin(), objects.end(), 1000);
+    return result(name, objects.size(), objects.size(), timer, ok);
+}
+
+// Describes the table for the queries generated by DBSQLGeneratorImpl. The first field is the primary key, parameters
+// are positional.
+class BenchDescriptor : public DBObjectDescriptor<string, int> {
+private:
+    string table;
+    vector<string> fields;
+public:
+    BenchDescriptor(const string& t, const vector<string>& f) : DBObjectDescriptor<string, int>(), table(t), fields(f) {};
+    string tableName() const {return table;};
+    int keyFieldCount() const {return 1;};
+    int commonFieldCount() const {return static_cast<int>(fields.size()) - 1;};
+    string keyField(int /*index*/) const {return fields[0];};
+    string commonField(int index) const {return fields[index + 1];};
+    string parameterName(const string& /*fieldName*/) const {return "?";};
+};
+
+// Inserts objects with the multi-row query. The number of parameters is limited by 999 (the default limit of sqlite before
+// 3.32), because larger queries aren't faster and leave more objects to the single-row query. Operations are executed
+// queries.
+template <class Object, class Binder>
+BenchResult fillMultiRow(sqlite3* db, const string& name, BenchDescriptor& d, vector<Object>& objects)
+{
+    DBSQLGeneratorImpl<string, int> generator;
+    int maxParameters = min(sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, -1), 999);
+    int rowsPerQuery = generator.insertRowCount(&d, true, maxParameters);
+    DBSqliteStatement st(db, generator.insert(&d, true, rowsPerQuery));
+    DBSqliteStatement tail(db, generator.insert(&d, true));
+    Binder binder(nullptr);
+    Timer timer;
+    bool ok = executor.execBatch(st, tail, rowsPerQuery, &binder, objects.begin(), objects.end(), 1000);
+    size_t queries = (rowsPerQuery > 0) ? objects.size() / rowsPerQuery + objects.size() % rowsPerQuery : objects.size();
+    return result(name, queries, objects.size(), timer, ok);
+}
+
+void fillDB(sqlite3* db, const BenchConfig& config, mt19937& gen, vector<BenchResult>& results)
+{
+    vector<Customer> customers(config.customers);
+    for (int i = 0; i < config.customers; ++i) {
+        customers[i].id = i;
+        customers[i].name = L"customer" + to_wstring(i);
+    }
+    results.push_back(fill<Customer, CustomerBinder>(db, "fill customer", "insert into customer(id, name) values(?, ?)", customers));
+
+    uniform_int_distribution<int> customer(0, config.customers - 1);
+    vector<Account> accounts(config.accounts);
+    for (int i = 0; i < config.accounts; ++i) {
+        accounts[i].id = i;
+        accounts[i].ref_customer = customer(gen);
+    }
+    results.push_back(fill<Account, AccountBinder>(db, "fill account", "insert into account(id, ref_customer) values(?, ?)", accounts));
+
+    uniform_int_distribution<int> account(0, config.accounts - 1);
+    uniform_int_distribution<int> amount(1, 10);
+    vector<Transaction> trans(config.trans);
+    for (int i = 0; i < config.trans; ++i) {
+        trans[i].id = i;
+        trans[i].ref_account = account(gen);
+        trans[i].amount = amount(gen);
+    }
+    BenchDescriptor tranDescriptor("tran", {"id", "ref_account", "amount"});
+    results.push_back(fillMultiRow<Transaction, TransactionBinder>(db, "fill tran multirow", tranDescriptor, trans));
+}
+
+BenchResult customerLookup(sqlite3* db, const BenchConfig& config, mt19937& gen)
+{
+    DBSqliteStatement st(db, "select id as customer_id, name as customer_name from customer where id = ?");
+    uniform_int_distribution<int> customer(0, config.customers - 1);
+    Customer c;
+    Reader2Customer reader(&c);
+    DBSqliteBind<int> binder(1, 0);
+    bool ok = true;
+    Timer timer;
+    for (int i = 0; ok && (i < config.lookups); ++i) {
+        binder.setValue(customer(gen));
+        ok = executor.exec(st, &binder, &reader);
+    }
+    return result("customer lookup", config.lookups, config.lookups, timer, ok);
+}
+
+BenchResult customerRange(sqlite3* db, const BenchConfig& config)
+{
+    DBSqliteStatement st(db, "select id as customer_id, name as customer_name from customer where id >= ? and id <= ?");
+    CustomerVector v;
+    Reader2Customer rc;
+    DBReader2STLContainer<DBSqliteStatement, Customer, CustomerVector> reader(&v, &rc);
+    DBSqliteBind<int> idMin(1, 0);
+    DBSqliteBind<int> idMax(2, config.customers - 1);
+    DBBinders<DBSqliteStatement> binder(&idMin, &idMax, false);
+    Timer timer;
+    bool ok = executor.exec(st, &binder, &reader);
+    return result("customer range", 1, v.size(), timer, ok);
+}
+
+BenchResult customerFullInfo(sqlite3* db, const BenchConfig& config, mt19937& gen)
+{
+    DBSqliteStatement st(db, string(queryFullInfo) + " where c.id = ?");
+    uniform_int_distribution<int> customer(0, config.customers - 1);
+    DBSqliteBind<int> binder(1, 0);
+    size_t rows = 0;
+    bool ok = true;
+    Timer timer;
+    for (int i = 0; ok && (i < config.lookups); ++i) {
+        CustomerFullInfo c;
+        Reader2CustomerFullInfo rc(&c);
+        CountingReader reader(&rc);
+        binder.setValue(customer(gen));
+        ok = executor.exec(st, &binder, &reader);
+        rows += reader.rows;
+    }
+    return result("customer full info lookup", config.lookups, rows, timer, ok);
+}
+
+BenchResult allCustomersFullInfo(sqlite3* db)
+{
+    typedef shared_ptr<CustomerFullInfo> CustomerFullInfoPtr;
+    DBSqliteStatement st(db, string(queryFullInfo) + " order by c.id");
+    vector<CustomerFullInfoPtr> v;
+    Reader2CustomerFullInfo rc;
+    SqliteKeyReader key;
+    key.field = "customer_id";
+    DBReader2IndexedSTLContainerPtr<DBSqliteStatement, CustomerFullInfo, vector<CustomerFullInfoPtr>, int, CustomerFullInfoPtr,
+        map<int, CustomerFullInfoPtr> > rv(&v, &rc, &key);
+    CountingReader reader(&rv);
+    Timer timer;
+    bool ok = executor.exec(st, nullptr, &reader);
+    return result("all customers full info", 1, reader.rows, timer, ok);
+}
+
+BenchResult allCustomersFullInfoReadOnce(sqlite3* db)
+{
+    typedef shared_ptr<CustomerFullInfo> CustomerFullInfoPtr;
+    DBSqliteStatement st(db, string(queryFullInfo) + " order by c.id");
+    vector<CustomerFullInfoPtr> v;
+    Reader2CustomerHeader rc;
+    Reader2CustomerAccounts ra;
+    SqliteKeyReader key;
+    key.field = "customer_id";
+    DBReader2IndexedSTLContainerPtr<DBSqliteStatement, CustomerFullInfo, vector<CustomerFullInfoPtr>, int, CustomerFullInfoPtr,
+        map<int, CustomerFullInfoPtr> > rv(&v, &rc, &key);
+    DBSqliteNullReader accountNull("account_id");
+    rv.setDetailReader(&ra);
+    rv.setDetailNullReader(&accountNull);
+    rv.setReadOnce(true);
+    CountingReader reader(&rv);
+    Timer timer;
+    bool ok = executor.exec(st, nullptr, &reader);
+    return result("all customers read once", 1, reader.rows, timer, ok);
+}
+
+BenchResult allCustomersFlat(sqlite3* db)
+{
+    DBSqliteStatement st(db, string(queryFullInfo) + " order by c.id, a.id, t.id");
+    vector<Customer> customers;
+    vector<Account> accounts;
+    vector<Transaction> trans;
+    Reader2Customer rc;
+    Reader2Account ra;
+    Reader2Transaction rt;
+    SqliteKeyReader customerKey, accountKey, tranKey;
+    customerKey.field = "customer_id";
+    accountKey.field = "account_id";
+    tranKey.field = "tran_id";
+    DBReader2FlatLevel<DBSqliteStatement, Customer, int> customerLevel(&customers, &rc, &customerKey);
+    DBReader2FlatLevel<DBSqliteStatement, Account, int> accountLevel(&accounts, &ra, &accountKey);
+    DBReader2FlatLevel<DBSqliteStatement, Transaction, int> tranLevel(&trans, &rt, &tranKey);
+    DBSqliteNullReader accountNull("account_id"), tranNull("tran_id");
+    accountLevel.setNullKeyReader(&accountNull);
+    tranLevel.setNullKeyReader(&tranNull);
+    customerLevel.setChild(&accountLevel);
+    accountLevel.setChild(&tranLevel);
+    CountingReader reader(&customerLevel);
+    Timer timer;
+    bool ok = executor.exec(st, nullptr, &reader);
+    return result("all customers full info flat", 1, reader.rows, timer, ok);
+}
+
+// Returns zero instead of inf for the case too fast for the clock, so the output stays valid JSON.
+double perSecond(size_t count, double seconds)
+{
+    return (seconds > 0) ? count / seconds : 0;
+}
+
+string jsonString(const string& s)
+{
+    string result = "\"";
+    for (auto i = s.begin(); i != s.end(); ++i) {
+        if ((*i == '"') || (*i == '\\'))
+            result += '\\';
+        result += *i;
+    }
+    return result + "\"";
+}
+
+bool writeJson(const BenchConfig& config, const vector<BenchResult>& results)
+{
+    ofstream os(config.output);
+    os << "{" << endl;
+    os << "  \"config\": {\"customers\": " << config.customers << ", \"accounts\": " << config.accounts
+       << ", \"trans\": " << config.trans << ", \"lookups\": " << config.lookups << ", \"seed\": " << config.seed
+       << ", \"database\": " << jsonString(config.database) << "}," << endl;
+    os << "  \"results\": [" << endl;
+    for (auto i = results.begin(); i != results.end(); ++i) {
+        os << "    {\"name\": " << jsonString(i->name) << ", \"operations\": " << i->operations << ", \"rows\": " << i->rows
+           << ", \"seconds\": " << i->seconds << ", \"operations_per_sec\": " << perSecond(i->operations, i->seconds)
+           << ", \"rows_per_sec\": " << perSecond(i->rows, i->seconds) << ", \"ok\": " << (i->ok ? "true" : "false") << "}"
+           << ((i + 1 != results.end()) ? "," : "") << endl;
+    }
+    os << "  ]" << endl << "}" << endl;
+    return os.good();
+}
+
+void printResults(const vector<BenchResult>& results)
+{
+    cout << left << setw(30) << "benchmark" << right << setw(12) << "operations" << setw(12) << "rows"
+         << setw(12) << "seconds" << setw(14) << "ops/sec" << setw(14) << "rows/sec" << endl;
+    for (auto i = results.begin(); i != results.end(); ++i) {
+        cout << left << setw(30) << i->name << right << setw(12) << i->operations << setw(12) << i->rows
+             << setw(12) << fixed << setprecision(3) << i->seconds << setprecision(0) << setw(14) << perSecond(i->operations, i->seconds)
+             << setw(14) << perSecond(i->rows, i->seconds) << (i->ok ? "" : "  FAILED") << endl;
+    }
+}
+
+void printUsage()
+{
+    cout << "Usage: sqlite [--customers N] [--accounts N] [--trans N] [--lookups N] [--seed N] [--db FILE] [--out FILE]" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    BenchConfig config;
+
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 == argc) {
+            printUsage();
+            return 1;
+        }
+        if (strcmp(argv[i], "--customers") == 0)
+            config.customers = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--accounts") == 0)
+            config.accounts = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--trans") == 0)
+            config.trans = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--lookups") == 0)
+            config.lookups = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0)
+            config.seed = static_cast<unsigned>(atol(argv[++i]));
+        else if (strcmp(argv[i], "--db") == 0)
+            config.database = argv[++i];
+        else if (strcmp(argv[i], "--out") == 0)
+            config.output = argv[++i];
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+    if ((config.customers <= 0) || (config.accounts <= 0) || (config.trans < 0) || (config.lookups < 0)) {
+        printUsage();
+        return 1;
+    }
+
+    sqlite3* db = nullptr;
+    if ((sqlite3_open(config.database.c_str(), &db) != SQLITE_OK) || !createSchema(db)) {
+        cout << "Can't create database " << config.database << ": " << sqlite3_errmsg(db) << endl;
+        sqlite3_close(db);
+        return 1;
+    }
+
+    mt19937 gen(config.seed);
+    vector<BenchResult> results;
+    fillDB(db, config, gen, results);
+    results.push_back(customerLookup(db, config, gen));
+    results.push_back(customerRange(db, config));
+    results.push_back(customerFullInfo(db, config, gen));
+    results.push_back(allCustomersFullInfo(db));
+    results.push_back(allCustomersFullInfoReadOnce(db));
+    results.push_back(allCustomersFlat(db));
+    sqlite3_close(db);
+
+    printResults(results);
+    bool ok = writeJson(config, results);
+    for (auto i = results.begin(); i != results.end(); ++i)
+        ok = ok && i->ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+#-------------------------------------------------
+#
+# End-to-end SQLite benchmark on the example schema
+#
+#-------------------------------------------------
+
+QT       -= core gui
+
+TARGET = sqlite
+CONFIG   += console c++11
+CONFIG   -= app_bundle qt
+
+TEMPLATE = app
+
+
+SOURCES += main.cpp \
+    sqlitereaders.cpp \
+    ../../example/testtypes.cpp \
+    ../../example/testschema.cpp
+
+
+HEADERS += \
+    sqlitereaders.h
+
+INCLUDEPATH += ../.. ../../example
+
+LIBS += -lsqlite3
@@ -0,0 +1,235 @@
+#include "sqlitereaders.h"
+#include <codecvt>
+#include <locale>
+
+using namespace dbframework;
+
+std::wstring fromUtf8(const std::string& s)
+{
+    std::wstring_convert<std::codecvt_utf8<wchar_t> > convert;
+    return convert.from_bytes(s);
+}
+
+std::string toUtf8(const std::wstring& s)
+{
+    std::wstring_convert<std::codecvt_utf8<wchar_t> > convert;
+    return convert.to_bytes(s);
+}
+
+bool checkIdField(int index, DBSqliteStatement& ds, int* id)
+{
+    bool result = (index >= 0) && !ds.isNull(index);
+    if (result)
+        ds.readColumn(index, *id);
+    return result;
+}
+
+void Reader2Customer::addColumns()
+{
+    colId = columns.add("customer_id");
+    colName = columns.add("customer_name");
+}
+
+void Reader2Customer::begin(DBSqliteStatement& ds)
+{
+    columns.resolve(ds);
+}
+
+bool Reader2Customer::read(DBSqliteStatement& ds)
+{
+    bool result = checkIdField(columns[colId], ds, &m_object->id);
+    if (result) {
+        ds.readColumn(columns[colName], name);
+        m_object->name = fromUtf8(name);
+    }
+    return result;
+}
+
+void Reader2Account::addColumns()
+{
+    colId = columns.add("account_id");
+    colRefCustomer = columns.add("account_ref_customer");
+}
+
+void Reader2Account::begin(DBSqliteStatement& ds)
+{
+    columns.resolve(ds);
+}
+
+bool Reader2Account::read(DBSqliteStatement& ds)
+{
+    bool result = checkIdField(columns[colId], ds, &m_object->id);
+    if (result)
+        ds.readColumn(columns[colRefCustomer], m_object->ref_customer);
+    return result;
+}
+
+void Reader2Transaction::addColumns()
+{
+    colId = columns.add("tran_id");
+    colRefAccount = columns.add("tran_ref_account");
+    colAmount = columns.add("tran_amount");
+}
+
+void Reader2Transaction::begin(DBSqliteStatement& ds)
+{
+    columns.resolve(ds);
+}
+
+bool Reader2Transaction::read(DBSqliteStatement& ds)
+{
+    bool result = checkIdField(columns[colId], ds, &m_object->id);
+    if (result) {
+        ds.readColumn(columns[colRefAccount], m_object->ref_account);
+        ds.readColumn(columns[colAmount], m_object->amount);
+    }
+    return result;
+}
+
+void Reader2AccountWithTrans::begin(DBSqliteStatement& ds)
+{
+    readAccount.begin(ds);
+    readTransactions.begin(ds);
+}
+
+void Reader2AccountWithTrans::end(DBSqliteStatement& ds, bool ok)
+{
+    readAccount.end(ds, ok);
+    readTransactions.end(ds, ok);
+}
+
+bool Reader2AccountWithTrans::read(DBSqliteStatement& ds)
+{
+    readAccount.setObject(&m_object->account);
+    readTransactions.setContainer(&m_object->transactions);
+    bool result = readAccount.read(ds);
+    if (result) {
+        readTransactions.read(ds);
+    }
+    return result;
+}
+
+void SqliteKeyReader::begin(DBSqliteStatement& ds)
+{
+    index = ds.columnIndex(field);
+}
+
+bool SqliteKeyReader::read(DBSqliteStatement& ds)
+{
+    return checkIdField(index, ds, m_object);
+}
+
+void Reader2CustomerFullInfo::setReaders()
+{
+    readAccounts.setReader(&readAccount);
+    readAccounts.setKeyReader(&readKey);
+    readKey.field = "account_id";
+}
+
+void Reader2CustomerFullInfo::begin(DBSqliteStatement& ds)
+{
+    readCustomer.begin(ds);
+    readAccounts.begin(ds);
+}
+
+void Reader2CustomerFullInfo::end(DBSqliteStatement& ds, bool ok)
+{
+    readCustomer.end(ds, ok);
+    readAccounts.end(ds, ok);
+}
+
+bool Reader2CustomerFullInfo::read(DBSqliteStatement& ds)
+{
+    readCustomer.setObject(m_object);
+    readAccounts.setContainer(&m_object->accounts);
+    bool result = readCustomer.read(ds);
+    if (result) {
+        readAccounts.read(ds);
+    }
+    return result;
+}
+
+void Reader2CustomerHeader::begin(DBSqliteStatement& ds)
+{
+    readCustomer.begin(ds);
+}
+
+bool Reader2CustomerHeader::read(DBSqliteStatement& ds)
+{
+    readCustomer.setObject(m_object);
+    return readCustomer.read(ds);
+}
+
+void Reader2AccountHeader::begin(DBSqliteStatement& ds)
+{
+    readAccount.begin(ds);
+}
+
+bool Reader2AccountHeader::read(DBSqliteStatement& ds)
+{
+    readAccount.setObject(&m_object->account);
+    return readAccount.read(ds);
+}
+
+void Reader2AccountTransactions::begin(DBSqliteStatement& ds)
+{
+    readTransactions.begin(ds);
+}
+
+void Reader2AccountTransactions::end(DBSqliteStatement& ds, bool ok)
+{
+    readTransactions.end(ds, ok);
+}
+
+bool Reader2AccountTransactions::read(DBSqliteStatement& ds)
+{
+    readTransactions.setContainer(&m_object->transactions);
+    return readTransactions.read(ds);
+}
+
+Reader2CustomerAccounts::Reader2CustomerAccounts() : DBReader2Object<DBSqliteStatement, CustomerFullInfo>(),
+    tranNull("tran_id")
+{
+    readKey.field = "account_id";
+    readAccounts.setReader(&readAccount);
+    readAccounts.setKeyReader(&readKey);
+    readAccounts.setDetailReader(&readTransactions);
+    readAccounts.setDetailNullReader(&tranNull);
+    readAccounts.setReadOnce(true);
+}
+
+void Reader2CustomerAccounts::begin(DBSqliteStatement& ds)
+{
+    readAccounts.begin(ds);
+}
+
+void Reader2CustomerAccounts::end(DBSqliteStatement& ds, bool ok)
+{
+    readAccounts.end(ds, ok);
+}
+
+bool Reader2CustomerAccounts::read(DBSqliteStatement& ds)
+{
+    readAccounts.setContainer(&m_object->accounts);
+    return readAccounts.read(ds);
+}
+
+void CustomerBinder::bind(DBSqliteStatement& dataset)
+{
+    name = toUtf8(m_object->name);
+    dataset.bindParameter(1, m_object->id);
+    dataset.bindStaticText(2, name.c_str(), static_cast<int>(name.size()));
+}
+
+void AccountBinder::bind(DBSqliteStatement& dataset)
+{
+    dataset.bindParameter(1, m_object->id);
+    dataset.bindParameter(2, m_object->ref_customer);
+}
+
+void TransactionBinder::bind(DBSqliteStatement& dataset)
+{
+    dataset.bindParameter(1, m_object->id);
+    dataset.bindParameter(2, m_object->ref_account);
+    dataset.bindParameter(3, m_object->amount);
+}
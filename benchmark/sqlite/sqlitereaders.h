@@ -0,0 +1,160 @@
+#ifndef SQLITEREADERS_H
+#define SQLITEREADERS_H
+
+#include <string>
+#include "dbframework.h"
+#include "sqlite/dbsqlite.h"
+#include "testtypes.h"
+
+// Readers and binders of the example application implemented for DBSqliteStatement. The example's readers are
+// written for QSqlQuery and read QString columns, so they can't be reused without Qt; only the data classes
+// (testtypes.h) are shared. Keep the readers in sync with example/myreaders.h when the example changes.
+
+std::wstring fromUtf8(const std::string& s);
+std::string toUtf8(const std::wstring& s);
+
+class Reader2Customer : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, Customer> {
+private:
+    dbframework::DBSqliteColumns columns;
+    int colId;
+    int colName;
+    std::string name;
+    void addColumns();
+public:
+    Reader2Customer() : DBReader2Object<dbframework::DBSqliteStatement, Customer>(){addColumns();};
+    Reader2Customer(Customer* c) : DBReader2Object<dbframework::DBSqliteStatement, Customer>(c){addColumns();};
+    void begin(dbframework::DBSqliteStatement& ds);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+class Reader2Account : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, Account> {
+private:
+    dbframework::DBSqliteColumns columns;
+    int colId;
+    int colRefCustomer;
+    void addColumns();
+public:
+    Reader2Account() : DBReader2Object<dbframework::DBSqliteStatement, Account>(){addColumns();};
+    void begin(dbframework::DBSqliteStatement& ds);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+class Reader2Transaction : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, Transaction> {
+private:
+    dbframework::DBSqliteColumns columns;
+    int colId;
+    int colRefAccount;
+    int colAmount;
+    void addColumns();
+public:
+    Reader2Transaction() : DBReader2Object<dbframework::DBSqliteStatement, Transaction>(){addColumns();};
+    void begin(dbframework::DBSqliteStatement& ds);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+class Reader2AccountWithTrans : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, AccountWithTrans> {
+private:
+    Reader2Account readAccount;
+    Reader2Transaction readTransaction;
+    dbframework::DBReader2STLContainerPtr<dbframework::DBSqliteStatement, Transaction, TransactionVector, TransactionPtr> readTransactions;
+public:
+    Reader2AccountWithTrans() : DBReader2Object<dbframework::DBSqliteStatement, AccountWithTrans>(){readTransactions.setReader(&readTransaction);};
+    void begin(dbframework::DBSqliteStatement& ds);
+    void end(dbframework::DBSqliteStatement& ds, bool ok);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+// Reads integer key. Fails on NULL, so left joined rows without detail are skipped.
+class SqliteKeyReader : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, int> {
+private:
+    int index;
+public:
+    std::string field;
+    SqliteKeyReader() : DBReader2Object<dbframework::DBSqliteStatement, int>(), index(-1){};
+    void begin(dbframework::DBSqliteStatement& ds);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+class Reader2CustomerFullInfo : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, CustomerFullInfo> {
+private:
+    Reader2Customer readCustomer;
+    Reader2AccountWithTrans readAccount;
+    SqliteKeyReader readKey;
+    dbframework::DBReader2IndexedSTLContainerPtr<dbframework::DBSqliteStatement, AccountWithTrans, AccountWithTransVector,
+        int, AccountWithTransPtr, AccountWithTransMap> readAccounts;
+    void setReaders();
+public:
+    Reader2CustomerFullInfo() : DBReader2Object<dbframework::DBSqliteStatement, CustomerFullInfo>(){setReaders();};
+    Reader2CustomerFullInfo(CustomerFullInfo* c) : DBReader2Object<dbframework::DBSqliteStatement, CustomerFullInfo>(c){setReaders();};
+    void begin(dbframework::DBSqliteStatement& ds);
+    void end(dbframework::DBSqliteStatement& ds, bool ok);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+// Readers of CustomerFullInfo for the read once mode of DBReader2Associative: master fields are read only from the first
+// record of the master, details are read by detail readers from every record.
+class Reader2CustomerHeader : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, CustomerFullInfo> {
+private:
+    Reader2Customer readCustomer;
+public:
+    Reader2CustomerHeader() : DBReader2Object<dbframework::DBSqliteStatement, CustomerFullInfo>(){};
+    void begin(dbframework::DBSqliteStatement& ds);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+class Reader2AccountHeader : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, AccountWithTrans> {
+private:
+    Reader2Account readAccount;
+public:
+    Reader2AccountHeader() : DBReader2Object<dbframework::DBSqliteStatement, AccountWithTrans>(){};
+    void begin(dbframework::DBSqliteStatement& ds);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+class Reader2AccountTransactions : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, AccountWithTrans> {
+private:
+    Reader2Transaction readTransaction;
+    dbframework::DBReader2STLContainerPtr<dbframework::DBSqliteStatement, Transaction, TransactionVector, TransactionPtr> readTransactions;
+public:
+    Reader2AccountTransactions() : DBReader2Object<dbframework::DBSqliteStatement, AccountWithTrans>(){readTransactions.setReader(&readTransaction);};
+    void begin(dbframework::DBSqliteStatement& ds);
+    void end(dbframework::DBSqliteStatement& ds, bool ok);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+class Reader2CustomerAccounts : public dbframework::DBReader2Object<dbframework::DBSqliteStatement, CustomerFullInfo> {
+private:
+    Reader2AccountHeader readAccount;
+    Reader2AccountTransactions readTransactions;
+    SqliteKeyReader readKey;
+    dbframework::DBSqliteNullReader tranNull;
+    dbframework::DBReader2IndexedSTLContainerPtr<dbframework::DBSqliteStatement, AccountWithTrans, AccountWithTransVector,
+        int, AccountWithTransPtr, AccountWithTransMap> readAccounts;
+public:
+    Reader2CustomerAccounts();
+    void begin(dbframework::DBSqliteStatement& ds);
+    void end(dbframework::DBSqliteStatement& ds, bool ok);
+    bool read(dbframework::DBSqliteStatement& ds);
+};
+
+class CustomerBinder : public dbframework::DBBindObject<dbframework::DBSqliteStatement, Customer> {
+private:
+    std::string name;
+public:
+    CustomerBinder(Customer* c):DBBindObject<dbframework::DBSqliteStatement, Customer>(c){};
+    void bind(dbframework::DBSqliteStatement& dataset);
+};
+
+class AccountBinder : public dbframework::DBBindObject<dbframework::DBSqliteStatement, Account> {
+public:
+    AccountBinder(Account* acc):DBBindObject<dbframework::DBSqliteStatement, Account>(acc){};
+    void bind(dbframework::DBSqliteStatement& dataset);
+};
+
+class TransactionBinder : public dbframework::DBBindObject<dbframework::DBSqliteStatement, Transaction> {
+public:
+    TransactionBinder(Transaction* t):DBBindObject<dbframework::DBSqliteStatement, Transaction>(t){};
+    void bind(dbframework::DBSqliteStatement& dataset);
+};
+
+#endif // SQLITEREADERS_H
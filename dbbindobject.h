@@ -49,6 +49,16 @@ public:
         The DBBindObject doesn't take ownership of object.
      */
     DBBindObject(Object* object) : DBBinder<Dataset>(), m_object(object) {};
+    /*!
+        Get pointer to the object which members are binded with SQL query parameters.
+        @return Pointer to the object.
+    */
+    Object* object() {return m_object;};
+    /*!
+        Assosiate object which members are binded with SQL query parameters with DBBindObject instance.
+        @param[in] object Pointer to Object instance. The DBBindObject doesn't take ownership of object.
+    */
+    void setObject(Object* object) {m_object = object;};
 };
 
 }
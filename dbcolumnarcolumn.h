@@ -0,0 +1,253 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBCOLUMNARCOLUMN_H
+#define DBCOLUMNARCOLUMN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "dbread2object.h"
+
+namespace dbframework {
+
+/*!
+    The DBColumnarColumnBase template class is the abstract interface of the column used by DBReader2Columnar. Usually you
+    shouldn't inherit from DBColumnarColumnBase, use DBColumnarColumn instead.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+*/
+template <class Dataset>
+class DBColumnarColumnBase {
+public:
+    /*!
+        Virtual destructor.
+    */
+    virtual ~DBColumnarColumnBase() {};
+    /*!
+        This method is called once for every SQL query execution result before reading records.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    virtual void begin(Dataset& ds) = 0;
+    /*!
+        This method is called once for every SQL query execution result after reading records.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    virtual void end(Dataset& ds, bool ok) = 0;
+    /*!
+        This method must read the column value from the current record and append it to the column.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    virtual bool append(Dataset& ds) = 0;
+    /*!
+        This method must remove values with indexes starting from size from the column.
+        @param[in] size New number of values in the column. Must not be greater than the current number of values.
+    */
+    virtual void truncate(size_t size) = 0;
+};
+
+/*!
+    The DBColumnarColumn template class stores the values of one column of the SQL query execution result in the
+    contiguous arrays of T and the null bitmap. Values are stored in chunks of the fixed size, so the column grows by
+    allocating a new chunk and existing values are never copied. Scans of the column should iterate over chunks using
+    chunkCount, chunkSize and chunk, so they touch only the memory of this column.
+
+    The value is read from the record with DBReader2Object<Dataset, T> instance. If the null reader is assosiated with the
+    column, it is used first to read the flag that shows whether the value is NULL. Default constructed T is stored for
+    NULL values.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    T is the type of column values. Must have default constructor.
+*/
+template <class Dataset, class T>
+class DBColumnarColumn : public DBColumnarColumnBase<Dataset> {
+public:
+    /*!
+        Type of DBReader2Object used to read the value.
+    */
+    typedef DBReader2Object<Dataset, T> ValueReaderType;
+    /*!
+        Type of DBReader2Object used to read the flag that shows whether the value is NULL.
+    */
+    typedef DBReader2Object<Dataset, bool> NullReaderType;
+private:
+    struct Chunk {
+        std::vector<T> values;
+        std::vector<uint64_t> nulls;
+    };
+
+    ValueReaderType* m_valueReader;
+    NullReaderType* m_nullReader;
+    size_t m_chunkSize;
+    size_t m_size;
+    std::vector<Chunk> m_chunks;
+    bool m_null;
+
+    Chunk& lastChunk()
+    {
+        if (m_size / m_chunkSize >= m_chunks.size()) {
+            m_chunks.push_back(Chunk());
+            m_chunks.back().values.reserve(m_chunkSize);
+            m_chunks.back().nulls.resize((m_chunkSize + 63) / 64);
+        }
+        return m_chunks[m_size / m_chunkSize];
+    };
+public:
+    /*!
+        Constructs DBColumnarColumn.
+        @param[in] valueReader Pointer to the DBReader2Object instance used to read the value. DBColumnarColumn doesn't take
+        ownership of valueReader.
+        @param[in] nullReader Pointer to the DBReader2Object instance used to read the NULL flag or nullptr if the column
+        doesn't contain NULL values. DBColumnarColumn doesn't take ownership of nullReader.
+        @param[in] chunkSize The number of values in one chunk. If zero, one is used.
+    */
+    DBColumnarColumn(ValueReaderType* valueReader, NullReaderType* nullReader = nullptr, size_t chunkSize = 4096) :
+        DBColumnarColumnBase<Dataset>(), m_valueReader(valueReader), m_nullReader(nullReader),
+        m_chunkSize((chunkSize > 0) ? chunkSize : 1), m_size(0), m_null(false) {};
+    /*!
+        Get the number of values in the column.
+        @return The number of values.
+    */
+    size_t size() const {return m_size;};
+    /*!
+        Get the number of values in one chunk.
+        @return The number of values in one chunk.
+    */
+    size_t chunkSize() const {return m_chunkSize;};
+    /*!
+        Get the number of allocated chunks.
+        @return The number of chunks.
+    */
+    size_t chunkCount() const {return m_chunks.size();};
+    /*!
+        Get the values stored in the chunk. The value with index row is stored in the chunk row / chunkSize() at
+        position row % chunkSize().
+        @param[in] index Index of the chunk (0 <= index < chunkCount()).
+        @return Values of the chunk.
+    */
+    const std::vector<T>& chunk(size_t index) const {return m_chunks[index].values;};
+    /*!
+        Get the value.
+        @param[in] row Index of the value (0 <= row < size()).
+        @return The value.
+    */
+    const T& value(size_t row) const {return m_chunks[row / m_chunkSize].values[row % m_chunkSize];};
+    /*!
+        Get the flag that shows whether the value is NULL.
+        @param[in] row Index of the value (0 <= row < size()).
+        @return True if the value is NULL.
+    */
+    bool isNull(size_t row) const
+    {
+        size_t offset = row % m_chunkSize;
+        return (m_chunks[row / m_chunkSize].nulls[offset / 64] & (uint64_t(1) << (offset % 64))) != 0;
+    };
+    /*!
+        Removes all values from the column and deallocates chunks.
+    */
+    void clear()
+    {
+        m_chunks.clear();
+        m_size = 0;
+    };
+    /*!
+        Passes the call to the assosiated readers.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        if (m_valueReader != nullptr)
+            m_valueReader->begin(ds);
+        if (m_nullReader != nullptr)
+            m_nullReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated readers.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        if (m_valueReader != nullptr)
+            m_valueReader->end(ds, ok);
+        if (m_nullReader != nullptr)
+            m_nullReader->end(ds, ok);
+    };
+    /*!
+        Reads the value from the current record and appends it to the column. The value is constructed in the chunk and
+        read directly to it, so it isn't copied.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool append(Dataset& ds)
+    {
+        if (m_valueReader == nullptr)
+            return false;
+
+        m_null = false;
+        if (m_nullReader != nullptr) {
+            m_nullReader->setObject(&m_null);
+            if (!m_nullReader->read(ds))
+                return false;
+        }
+
+        Chunk& c = lastChunk();
+        c.values.emplace_back();
+        if (m_null) {
+            size_t offset = m_size % m_chunkSize;
+            c.nulls[offset / 64] |= uint64_t(1) << (offset % 64);
+        }
+        else {
+            m_valueReader->setObject(&c.values.back());
+            if (!m_valueReader->read(ds)) {
+                c.values.pop_back();
+                return false;
+            }
+        }
+        ++m_size;
+        return true;
+    };
+    /*!
+        Removes values with indexes starting from size. Chunks that become empty are deallocated.
+        @param[in] size New number of values. Must not be greater than size().
+    */
+    void truncate(size_t size)
+    {
+        m_chunks.resize((size + m_chunkSize - 1) / m_chunkSize);
+        if (!m_chunks.empty()) {
+            Chunk& c = m_chunks.back();
+            size_t count = size - (m_chunks.size() - 1) * m_chunkSize;
+            c.values.resize(count);
+            for (size_t i = count; i < c.nulls.size() * 64; ++i)
+                c.nulls[i / 64] &= ~(uint64_t(1) << (i % 64));
+        }
+        m_size = size;
+    };
+};
+
+}
+
+#endif // DBCOLUMNARCOLUMN_H
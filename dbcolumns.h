@@ -0,0 +1,119 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBCOLUMNS_H
+#define DBCOLUMNS_H
+
+#include <vector>
+
+namespace dbframework {
+
+/*!
+    The DBColumns template class stores the list of names of the columns that some DBReader descendant reads and the indexes
+    of these columns in the current SQL query execution result. Reader declares required columns once by calling add and
+    stores returned column numbers. When SQL query execution result is available, the reader calls resolve from its
+    DBReader::begin implementation. After that the reader can get the index of the column in the Dataset record by
+    its column number using operator[] and read the column by index instead of searching it by name for every record.
+
+    Inherit from DBColumns and implement indexOf to get fully functional DBColumns descendant for a specific Dataset.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    S is a string type that is used to represent column name. Must have copy constructor.
+
+    I is an integer type that is used as column number and as the index of the column in the Dataset record.
+*/
+template <class Dataset, class S, class I>
+class DBColumns {
+private:
+    std::vector<S> m_names;
+    std::vector<I> m_indexes;
+protected:
+    /*!
+        This method must be implemented by the descendants. It must return the index of the column with the provided name in
+        the SQL query execution result.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] name Column name.
+        @return Index of the column.
+    */
+    virtual I indexOf(Dataset& ds, const S& name) const = 0;
+public:
+    /*!
+        Constructs empty DBColumns.
+    */
+    DBColumns() {};
+    /*!
+        Virtual destructor.
+    */
+    virtual ~DBColumns() {};
+    /*!
+        Adds column to the list of columns.
+        @param[in] name Column name.
+        @return Column number that must be used to get column index with operator[].
+    */
+    I add(const S& name)
+    {
+        m_names.push_back(name);
+        m_indexes.push_back(I());
+        return m_names.size() - 1;
+    };
+    /*!
+        Get the number of columns in the list.
+        @return The number of columns.
+    */
+    I count() const
+    {
+        return m_names.size();
+    };
+    /*!
+        Get column name.
+        @param[in] column Column number returned by add.
+        @return Column name.
+    */
+    S name(I column) const
+    {
+        return m_names[column];
+    };
+    /*!
+        Resolves all column names to their indexes in the SQL query execution result using indexOf. Call this method once for
+        every SQL query execution result before reading records.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void resolve(Dataset& ds)
+    {
+        for (typename std::vector<S>::size_type i = 0; i < m_names.size(); ++i) {
+            m_indexes[i] = indexOf(ds, m_names[i]);
+        }
+    };
+    /*!
+        Get the index of the column in the SQL query execution result. The index is valid after call to resolve.
+        @param[in] column Column number returned by add.
+        @return Index of the column.
+    */
+    I operator[](I column) const
+    {
+        return m_indexes[column];
+    };
+};
+
+}
+
+#endif // DBCOLUMNS_H
@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBCONTAINERELEMENT_H
+#define DBCONTAINERELEMENT_H
+
+#include <utility>
+
+namespace dbframework {
+
+template <class Object, class Container, class Reader, class Dataset>
+auto readContainerElement(Container& container, Reader& reader, Dataset& ds, int)
+    -> decltype(container.emplace_back(), container.pop_back(), bool())
+{
+    container.emplace_back();
+    reader.setObject(&container.back());
+    if (reader.read(ds))
+        return true;
+    container.pop_back();
+    return false;
+}
+
+template <class Object, class Container, class Reader, class Dataset>
+bool readContainerElement(Container& container, Reader& reader, Dataset& ds, long)
+{
+    Object obj;
+    reader.setObject(&obj);
+    if (!reader.read(ds))
+        return false;
+    container.push_back(std::move(obj));
+    return true;
+}
+
+/*!
+    Reads one element and appends it to the end of the container. If the container has emplace_back and pop_back methods
+    the element is constructed in place and removed if reading fails, otherwise the element is read into a temporary
+    Object which is moved into the container with push_back.
+    @param[in] container Container.
+    @param[in] reader Object reader used to read the element (any class with setObject and read methods).
+    @param[in] ds Dataset to read from.
+    @return Returns true if success.
+*/
+template <class Object, class Container, class Reader, class Dataset>
+bool readContainerElement(Container& container, Reader& reader, Dataset& ds)
+{
+    return readContainerElement<Object>(container, reader, ds, 0);
+}
+
+}
+
+#endif // DBCONTAINERELEMENT_H
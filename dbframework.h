@@ -78,19 +78,36 @@ The example subdirectory contains the example of application using dbframework.
 #define DBFRAMEWORK_H
 
 #include "dbreader.h"
+#include "dbcolumns.h"
 #include "dbread2object.h"
+#include "dbobjectfactory.h"
 #include "dbreader2stlcontainer.h"
 #include "dbreader2stlcontainerptr.h"
 #include "dbreader2stlassociative.h"
 #include "dbreader2stlassociativeptr.h"
 #include "dbreader2indexedstlcontainerptr.h"
+#include "dbreader2sortedstlcontainerptr.h"
+#include "dbreader2flatlevel.h"
+#include "dbreader2aggregate.h"
+#include "dbreader2columnar.h"
+#include "dbreader2topk.h"
+#include "dbreader2topkptr.h"
+#include "dbreader2callback.h"
+#include "dbreaderlimit.h"
+#include "dbstaticreader2associative.h"
 #include "dbbinder.h"
 #include "dbbind.h"
 #include "dbbindobject.h"
 #include "dbbinders.h"
+#include "dbstaticbinder.h"
 #include "dbreaderpair.h"
 #include "dbsqlgeneratorimpl.h"
+#include "dbqueryrange.h"
+#include "dbsqlexecobserver.h"
+#include "dbrowcounthistory.h"
 #include "dbsqlexec.h"
+#include "dbsqlstatistics.h"
+#include "dbstatementcache.h"
 #include "dbobjectdescriptorimpl.h"
 
 namespace dbframework {
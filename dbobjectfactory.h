@@ -0,0 +1,146 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBOBJECTFACTORY_H
+#define DBOBJECTFACTORY_H
+
+#include <memory>
+#include <type_traits>
+
+namespace dbframework {
+
+/*!
+    The DBNewObjectFactory template class is used by DBReader2STLContainerPtr, DBReader2STLAssociativePtr and
+    DBReader2IndexedSTLContainerPtr to create Object instances by default. It allocates every Object instance with new
+    operator and passes it to ObjectPtr constructor.
+
+    Object factory used by these readers must have methods:
+    - ObjectPtr create() that returns smart pointer to new Object instance constructed with default constructor;
+    - void destroy(ObjectPtr& p) that is called for the Object instance that wasn't added to the container because of
+    reading failure or that is removed from the container by DBReader2STLContainerPtr in recycle mode;
+    - bool reusable(const ObjectPtr& p) that checks if the Object instance stored in the container can be overwritten
+    by DBReader2STLContainerPtr in recycle mode.
+
+    Template parameters.
+
+    Object is the class which instances are created. Must have default constructor.
+
+    ObjectPtr is a class of smart pointer to Object. ObjectPtr must have constructor of the form ObjectPtr(Object* obj).
+    If ObjectPtr is simple pointer Object*, then destroy deallocates Object instance with delete. If ObjectPtr has
+    use_count method (like std::shared_ptr), then the Object instance is reusable only if it isn't shared.
+*/
+template <class Object, class ObjectPtr>
+class DBNewObjectFactory {
+private:
+    void destroy(ObjectPtr& p, std::true_type) const {delete p;};
+    void destroy(ObjectPtr& p, std::false_type) const {p = ObjectPtr();};
+    template <class P>
+    auto reusable(const P& p, int) const -> decltype(p.use_count(), bool()) {return (p != nullptr) && (p.use_count() == 1);};
+    template <class P>
+    bool reusable(const P& p, long) const {return p != nullptr;};
+public:
+    /*!
+        Creates Object instance.
+        @return Smart pointer to new Object instance.
+    */
+    ObjectPtr create() const
+    {
+        return ObjectPtr(new Object);
+    };
+    /*!
+        Releases Object instance created with create.
+        @param[in] p Smart pointer to Object instance.
+    */
+    void destroy(ObjectPtr& p) const
+    {
+        destroy(p, typename std::is_pointer<ObjectPtr>::type());
+    };
+    /*!
+        Checks if the Object instance can be overwritten with new data.
+        @param[in] p Smart pointer to Object instance.
+        @return True if p isn't null and the Object instance isn't shared with other smart pointers.
+    */
+    bool reusable(const ObjectPtr& p) const
+    {
+        return reusable(p, 0);
+    };
+};
+
+/*!
+    The DBSharedObjectFactory template class creates Object instances with std::allocate_shared, so that Object instance
+    and shared_ptr control block are allocated with one allocation from the provided allocator. Use it with
+    DBReader2STLContainerPtr, DBReader2STLAssociativePtr and DBReader2IndexedSTLContainerPtr when ObjectPtr is
+    std::shared_ptr<Object>.
+
+    With std::pmr::polymorphic_allocator and std::pmr::monotonic_buffer_resource (C++17) objects of the whole SQL query
+    execution result are allocated from a few large memory blocks, and the memory is freed at once by releasing the
+    memory resource. All containers holding created objects, including the index of DBReader2IndexedSTLContainerPtr
+    (see DBReader2IndexedSTLContainerPtr::clearIndex), must be destroyed or cleared before releasing the memory resource.
+
+    Template parameters.
+
+    Object is the class which instances are created. Must have default constructor.
+
+    Allocator is the allocator of Object that satisfies standard Allocator requirements. Must have copy constructor.
+*/
+template <class Object, class Allocator = std::allocator<Object> >
+class DBSharedObjectFactory {
+private:
+    Allocator m_allocator;
+public:
+    /*!
+        Constructs DBSharedObjectFactory.
+        @param[in] allocator Allocator used to allocate Object instances.
+    */
+    DBSharedObjectFactory(const Allocator& allocator = Allocator()) : m_allocator(allocator) {};
+    /*!
+        Get allocator used to allocate Object instances.
+        @return Allocator.
+    */
+    const Allocator& allocator() const {return m_allocator;};
+    /*!
+        Creates Object instance.
+        @return Shared pointer to new Object instance.
+    */
+    std::shared_ptr<Object> create() const
+    {
+        return std::allocate_shared<Object>(m_allocator);
+    };
+    /*!
+        Releases Object instance created with create.
+        @param[in] p Shared pointer to Object instance.
+    */
+    void destroy(std::shared_ptr<Object>& p) const
+    {
+        p.reset();
+    };
+    /*!
+        Checks if the Object instance can be overwritten with new data.
+        @param[in] p Shared pointer to Object instance.
+        @return True if p isn't null and the Object instance isn't shared with other shared pointers.
+    */
+    bool reusable(const std::shared_ptr<Object>& p) const
+    {
+        return (p != nullptr) && (p.use_count() == 1);
+    };
+};
+
+}
+
+#endif // DBOBJECTFACTORY_H
@@ -0,0 +1,236 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBQUERYRANGE_H
+#define DBQUERYRANGE_H
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include "dbbinder.h"
+#include "dbread2object.h"
+
+namespace dbframework {
+
+template <class Dataset>
+class DBSQLExecutor;
+
+/*!
+    The DBQueryRange template class provides access to SQL query execution result as to the input range of Object
+    instances, so that it can be iterated with range-based for loop. Records are fetched and read one by one as the
+    iterator advances, so only one record is held in memory. Breaking out of the loop leaves the rest of the result unread.
+    Usually DBQueryRange is created with DBSQLExecutor::query.
+
+    The query is executed by the first call to begin. Every record is read to the same Object instance owned by
+    DBQueryRange, so the reference obtained from the iterator is valid only until the iterator is incremented. The Object
+    reader must assign every field it reads. Use failed to check if the query execution or reading failed after the loop.
+    If the reader's readRow returns DBReadStatus::Stop, the record is returned and iteration ends after it. Reader's end is
+    called when iteration ends or when DBQueryRange is destroyed. If the result wasn't read to the end, DBSQLExecutor::finishQuery
+    is called after it.
+
+    DBQueryRange doesn't report execution timings to DBSQLExecObserver.
+
+    Template parameters.
+
+    Dataset - see DBSQLExecutor.
+
+    Object is the class which instance is used to store data of the current record. Must have default constructor.
+*/
+template <class Dataset, class Object>
+class DBQueryRange {
+public:
+    /*!
+        Type of the DBReader descendant used to read data and store it in the Object instance.
+    */
+    typedef DBReader2Object<Dataset, Object> Reader2ObjectType;
+    /*!
+        The input iterator over the records of SQL query execution result.
+    */
+    class iterator {
+    private:
+        DBQueryRange* m_range;
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef Object value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Object* pointer;
+        typedef Object& reference;
+        /*!
+            Constructs iterator.
+            @param[in] range Pointer to DBQueryRange or nullptr for the end iterator.
+        */
+        iterator(DBQueryRange* range = nullptr) : m_range(range) {};
+        /*!
+            Get Object with data of the current record.
+            @return Reference to Object.
+        */
+        Object& operator*() const {return m_range->m_object;};
+        /*!
+            Get Object with data of the current record.
+            @return Pointer to Object.
+        */
+        Object* operator->() const {return &m_range->m_object;};
+        /*!
+            Fetches and reads the next record.
+            @return Reference to this iterator.
+        */
+        iterator& operator++()
+        {
+            if (!m_range->fetch())
+                m_range = nullptr;
+            return *this;
+        };
+        /*!
+            Fetches and reads the next record. Because iterator is input iterator, the returned copy points to the same record.
+        */
+        void operator++(int) {++(*this);};
+        /*!
+            Compares iterators.
+            @param[in] other Other iterator.
+            @return True if both iterators reached the end.
+        */
+        bool operator==(const iterator& other) const {return m_range == other.m_range;};
+        /*!
+            Compares iterators.
+            @param[in] other Other iterator.
+            @return True if only one iterator reached the end.
+        */
+        bool operator!=(const iterator& other) const {return m_range != other.m_range;};
+    };
+private:
+    DBSQLExecutor<Dataset>* m_executor;
+    Dataset* m_ds;
+    DBBinder<Dataset>* m_binder;
+    Reader2ObjectType* m_reader;
+    Object m_object;
+    size_t m_count;
+    bool m_started;
+    bool m_valid;
+    bool m_failed;
+    bool m_stopped;
+    bool m_reading;
+
+    DBQueryRange(const DBQueryRange&) = delete;
+    DBQueryRange& operator=(const DBQueryRange&) = delete;
+
+    bool fetch()
+    {
+        m_valid = false;
+        if (!m_failed && !m_stopped) {
+            if (m_executor->next(*m_ds)) {
+                m_reader->setObject(&m_object);
+                DBReadStatus status = m_reader->readRow(*m_ds);
+                m_valid = (status != DBReadStatus::Failed);
+                m_failed = !m_valid;
+                m_stopped = (status == DBReadStatus::Stop);
+                if (m_valid)
+                    ++m_count;
+            }
+            else {
+                m_failed = m_executor->fetchFailed(*m_ds);
+            }
+        }
+        if (!m_valid)
+            finish();
+        return m_valid;
+    };
+    void finish()
+    {
+        if (m_reading) {
+            m_reading = false;
+            m_reader->end(*m_ds, !m_failed);
+            if (m_failed || m_stopped || m_valid)
+                m_executor->finishQuery(*m_ds);
+        }
+    };
+    void start()
+    {
+        m_started = true;
+        if (m_reader == nullptr) {
+            m_failed = true;
+            return;
+        }
+        if (m_binder != nullptr)
+            m_binder->bind(*m_ds);
+        m_failed = !m_executor->executeQuery(*m_ds);
+        if (!m_failed) {
+            m_reader->begin(*m_ds);
+            m_reading = true;
+            fetch();
+        }
+    };
+public:
+    /*!
+        Constructs DBQueryRange. The query isn't executed until begin is called.
+        @param[in] executor DBSQLExecutor used to execute the query. DBQueryRange doesn't take ownership of executor.
+        @param[in] ds Dataset object to use for query execution. It must have SQL query text set and be prepared for parameter
+        binding and query execution.
+        @param[in] binder Pointer to DBBinder descendant or nullptr. DBQueryRange doesn't take ownership of binder.
+        @param[in] reader Pointer to the Reader2ObjectType instance used to read Object data. DBQueryRange doesn't take ownership
+        of reader.
+    */
+    DBQueryRange(DBSQLExecutor<Dataset>* executor, Dataset* ds, DBBinder<Dataset>* binder, Reader2ObjectType* reader) :
+        m_executor(executor), m_ds(ds), m_binder(binder), m_reader(reader), m_object(), m_count(0), m_started(false),
+        m_valid(false), m_failed(false), m_stopped(false), m_reading(false) {};
+    /*!
+        Move constructor. Must not be used after iteration was started.
+        @param[in] other DBQueryRange to move from.
+    */
+    DBQueryRange(DBQueryRange&& other) :
+        m_executor(other.m_executor), m_ds(other.m_ds), m_binder(other.m_binder), m_reader(other.m_reader),
+        m_object(std::move(other.m_object)), m_count(other.m_count), m_started(other.m_started), m_valid(other.m_valid),
+        m_failed(other.m_failed), m_stopped(other.m_stopped), m_reading(false) {};
+    /*!
+        Destroys DBQueryRange. If iteration wasn't finished, calls reader's end.
+    */
+    ~DBQueryRange()
+    {
+        finish();
+    };
+    /*!
+        Executes the query on the first call and returns iterator pointing to the first record. Next calls return iterator
+        pointing to the current record.
+        @return Iterator pointing to the current record or end iterator if there are no more records.
+    */
+    iterator begin()
+    {
+        if (!m_started)
+            start();
+        return m_valid ? iterator(this) : iterator();
+    };
+    /*!
+        Get the end iterator.
+        @return End iterator.
+    */
+    iterator end() {return iterator();};
+    /*!
+        Check if query execution, fetching or reading failed.
+        @return True if executeQuery, fetching the record (see DBSQLExecutor::fetchFailed) or reader failed.
+    */
+    bool failed() const {return m_failed;};
+    /*!
+        Get the number of records read.
+        @return The number of records read.
+    */
+    size_t count() const {return m_count;};
+};
+
+}
+
+#endif // DBQUERYRANGE_H
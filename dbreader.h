@@ -20,8 +20,29 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef DBREADER_H
 #define DBREADER_H
 
+#include <cstddef>
+
 namespace dbframework {
 
+/*!
+    The result of reading one record with DBReader::readRow.
+*/
+enum class DBReadStatus {
+    /*!
+        Reading failed. DBSQLExecutor stops iteration and reports failure.
+    */
+    Failed,
+    /*!
+        The record was read. DBSQLExecutor continues with the next record.
+    */
+    Continue,
+    /*!
+        The record was read and no more records are required. DBSQLExecutor stops iteration without fetching more records
+        and reports success.
+    */
+    Stop
+};
+
 /*!
     The DBReader template class provides the abstract interface for classes that read SQL query execution result.
     This is the base class for all such classes in dbframework. Usually you shouldn't inherit from DBReader directly.
@@ -50,8 +71,79 @@ public:
         @return True if success.
     */
     virtual bool read(Dataset& ds) = 0;
+    /*!
+        This method is called once for every SQL query execution result before the first call to read. Override it to do one-time
+        setup for the result, for example to resolve the names of the columns, required by the reader, to their indexes (see
+        DBColumns), so that read can access the columns of the current record by index. Readers that use nested readers must
+        pass the call to them. Default implementation does nothing.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    virtual void begin(Dataset& /*ds*/) {};
+    /*!
+        This method is called once for every SQL query execution result after the last call to read, if begin was called.
+        Override it to release temporary memory used while reading (for example, indexes) or to flush buffered data. Readers
+        that use nested readers must pass the call to them. Default implementation does nothing.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok False if reading failed, true if all records were read or reading was stopped with DBReadStatus::Stop.
+    */
+    virtual void end(Dataset& /*ds*/, bool /*ok*/) {};
+    /*!
+        Sets the expected size of the next SQL query execution result: the number of records or, for readers that store
+        several records in one element of the container, the number of elements (see resultSize). Readers that store data in
+        containers use it in begin to reserve space in the containers (see reserveAdditional), so that the containers aren't
+        reallocated or rehashed while reading. Readers that use nested readers should pass the call to them if the hint applies
+        to them. The hint is set until it is changed. Default implementation does nothing.
+        @param[in] count The expected size of the result or zero if it is unknown.
+    */
+    virtual void setRowCountHint(size_t /*count*/) {};
+    /*!
+        Get the size of the last read SQL query execution result in the units of setRowCountHint. It is called after end
+        by DBSQLExecutor::exec to record the result in DBRowCountHistory. Readers that store several records in one element
+        of the container (for example, readers with Key) return the number of elements added, so that the hint isn't
+        multiplied by the number of records per element. Readers that use nested readers should pass the call to them.
+        Default implementation returns rows.
+        @param[in] rows The number of records read.
+        @return The size of the result.
+    */
+    virtual size_t resultSize(size_t rows) const {return rows;};
+    /*!
+        This method is used by DBSQLExecutor to read every record. Default implementation calls read and returns
+        DBReadStatus::Continue if it succeeded or DBReadStatus::Failed otherwise. Override it to stop reading as soon as the
+        required records are read, for example see DBReaderLimit.
+        @param[in] ds Dataset to read from.
+        @return Status of reading.
+    */
+    virtual DBReadStatus readRow(Dataset& ds)
+    {
+        return read(ds) ? DBReadStatus::Continue : DBReadStatus::Failed;
+    };
 };
 
+template <class Reader, class Dataset>
+auto readRecord(Reader& reader, Dataset& ds, int) -> decltype(reader.readRow(ds))
+{
+    return reader.readRow(ds);
+}
+
+template <class Reader, class Dataset>
+DBReadStatus readRecord(Reader& reader, Dataset& ds, long)
+{
+    return reader.read(ds) ? DBReadStatus::Continue : DBReadStatus::Failed;
+}
+
+/*!
+    Reads the record with the reader. Calls readRow method of the reader if it has one (DBReader descendants and static
+    readers that implement it), otherwise calls read method.
+    @param[in] reader Reader.
+    @param[in] ds Dataset to read from.
+    @return Status of reading.
+*/
+template <class Reader, class Dataset>
+DBReadStatus readRecord(Reader& reader, Dataset& ds)
+{
+    return readRecord(reader, ds, 0);
+}
+
 }
 
 #endif // DBREADER_H
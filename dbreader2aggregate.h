@@ -0,0 +1,218 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBREADER2AGGREGATE_H
+#define DBREADER2AGGREGATE_H
+
+#include <cstddef>
+#include "dbreader2containerwithkey.h"
+
+namespace dbframework {
+
+/*!
+    The DBAggregate template class accumulates the number of values, their sum, minimum and maximum. It is the default
+    aggregate of DBReader2Aggregate.
+
+    The aggregate used by DBReader2Aggregate must have default constructor and the method void add(const Value& value)
+    that adds the value to the aggregate.
+
+    Template parameters.
+
+    Value is the type of aggregated values. Value must have default constructor that initializes it with zero,
+    operator += and operator <. Value must have operator / with size_t argument to use average.
+*/
+template <class Value>
+class DBAggregate {
+private:
+    size_t m_count;
+    Value m_sum;
+    Value m_min;
+    Value m_max;
+public:
+    /*!
+        Constructs empty DBAggregate.
+    */
+    DBAggregate() : m_count(0), m_sum(), m_min(), m_max() {};
+    /*!
+        Adds the value to the aggregate.
+        @param[in] value Value.
+    */
+    void add(const Value& value)
+    {
+        if (m_count == 0) {
+            m_min = value;
+            m_max = value;
+        }
+        else {
+            if (value < m_min)
+                m_min = value;
+            if (m_max < value)
+                m_max = value;
+        }
+        m_sum += value;
+        ++m_count;
+    };
+    /*!
+        Get the number of added values. DBReader2Aggregate doesn't add NULL values if its null reader is set, so like SQL
+        COUNT(column) the count doesn't include them.
+        @return The number of values.
+    */
+    size_t count() const {return m_count;};
+    /*!
+        Get the sum of added values.
+        @return The sum of values.
+    */
+    const Value& sum() const {return m_sum;};
+    /*!
+        Get the minimum of added values.
+        @return The minimum value or default constructed Value if no values were added.
+    */
+    const Value& min() const {return m_min;};
+    /*!
+        Get the maximum of added values.
+        @return The maximum value or default constructed Value if no values were added.
+    */
+    const Value& max() const {return m_max;};
+    /*!
+        Get the average of added values.
+        @return The average value or default constructed Value if no values were added.
+    */
+    Value average() const {return (m_count == 0) ? Value() : m_sum / m_count;};
+};
+
+/*!
+    The DBReader2Aggregate template class is the DBReader2ContainerWithKey descendant that reads the key and the value from
+    every record of the SQL query execution result and adds the value to the aggregate associated with the key in the
+    associative container, for example the total amount of transactions per account. Detail objects aren't stored, so
+    the memory used by DBReader2Aggregate is proportional to the number of distinct keys. The key and the value are read
+    to instances owned by DBReader2Aggregate, which are reused for every record.
+
+    Like SQL aggregate functions, DBReader2Aggregate skips NULL values if the null reader is set (see setNullReader): the
+    value of the record with NULL value isn't read and isn't added to the aggregate, but the aggregate for the key is
+    still added to the container, so count of the key is zero if all its values are NULL. Without the null reader every
+    value is added to the aggregate.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Value is the type of aggregated values. The value is read with Reader2ObjectType (DBReader2Object<Dataset, Value>)
+    instance. Must have default constructor.
+
+    Container is the associative container of pairs <Key, Aggregate> from STL library (for example,
+    std::map<Key, DBAggregate<Value> >) or compatible container, see DBReader2STLAssociative.
+
+    Key is the type of the key. Key is read with Reader2KeyType instance. If Key is a class then it must have default
+    constructor.
+
+    Aggregate is the class of the aggregate, see DBAggregate.
+*/
+template <class Dataset, class Value, class Container, class Key, class Aggregate = DBAggregate<Value> >
+class DBReader2Aggregate : public DBReader2ContainerWithKey<Dataset, Value, Container, Key> {
+private:
+    typedef DBReader2ContainerWithKey<Dataset, Value, Container, Key> AncestorType;
+    DBReader2Object<Dataset, bool>* m_nullReader;
+    Key m_key;
+    Value m_value;
+    bool m_isNull;
+public:
+    /*!
+        Constructs DBReader2Aggregate without assosiated container and DBReader2Object instances for Key and Value.
+    */
+    DBReader2Aggregate() : AncestorType(), m_nullReader(nullptr), m_key(), m_value(), m_isNull(false) {};
+    /*!
+        Constructs DBReader2Aggregate with assosiated container and DBReader2Object instances for Key and Value.
+        @param[in] container Pointer to the associative container that is used to store aggregates. The DBReader2Aggregate
+        doesn't take ownership of container.
+        @param[in] valueReader Pointer to the DBReader2Object descendant instance that is used to read Value data. The
+        DBReader2Aggregate doesn't take ownership of the valueReader.
+        @param[in] keyReader Pointer to the DBReader2Object descendant instance that is used to read Key data. The
+        DBReader2Aggregate doesn't take ownership of the keyReader.
+        @param[in] nullReader Pointer to the DBReader2Object instance used to read the NULL flag of the value or nullptr if
+        the value can't be NULL. DBReader2Aggregate doesn't take ownership of nullReader.
+    */
+    DBReader2Aggregate(Container* container, typename AncestorType::Reader2ObjectType* valueReader,
+        typename AncestorType::Reader2KeyType* keyReader, DBReader2Object<Dataset, bool>* nullReader = nullptr) :
+        AncestorType(container, valueReader, keyReader), m_nullReader(nullReader), m_key(), m_value(), m_isNull(false) {};
+    /*!
+        Get the reader of the NULL flag of the value.
+        @return Pointer to the null reader or nullptr if it isn't set.
+    */
+    DBReader2Object<Dataset, bool>* nullReader() {return m_nullReader;};
+    /*!
+        Sets the reader of the flag that shows whether the value of the record is NULL, for example DBSqliteNullReader.
+        @param[in] reader Pointer to the null reader or nullptr. DBReader2Aggregate doesn't take ownership of reader.
+    */
+    void setNullReader(DBReader2Object<Dataset, bool>* reader) {m_nullReader = reader;};
+    /*!
+        Passes the call to the assosiated readers, including the null reader.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        AncestorType::begin(ds);
+        if (m_nullReader != nullptr)
+            m_nullReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated readers, including the null reader.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        if (m_nullReader != nullptr)
+            m_nullReader->end(ds, ok);
+    };
+    /*!
+        Reads Key and Value from Dataset instance current record and adds Value to the aggregate associated with Key.
+        If the container doesn't have the aggregate for Key, then it is added. NULL value isn't read and isn't added to the
+        aggregate if the null reader is set.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((AncestorType::m_keyReader == nullptr) || (AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        AncestorType::m_keyReader->setObject(&m_key);
+        if (!AncestorType::m_keyReader->read(ds))
+            return false;
+        if (m_nullReader != nullptr) {
+            m_nullReader->setObject(&m_isNull);
+            if (!m_nullReader->read(ds))
+                return false;
+            if (m_isNull) {
+                (*AncestorType::m_container)[m_key];
+                return true;
+            }
+        }
+        AncestorType::m_objectReader->setObject(&m_value);
+        if (!AncestorType::m_objectReader->read(ds))
+            return false;
+        (*AncestorType::m_container)[m_key].add(m_value);
+        return true;
+    };
+};
+
+}
+
+#endif // DBREADER2AGGREGATE_H
@@ -41,6 +41,13 @@ namespace dbframework {
     in this case ensures that the DetailClass instatnce filled from the record data will be added to the vector of
     corresponding MasterSuperClass instance.
 
+    In such a query every record repeats the fields of the Master table. By default Object data is read from every record. In
+    the read once mode (see setReadOnce) Object data is read only from the first record with the Key value, when objectByKey
+    creates new Object instance, so the conversion of Master fields isn't repeated for every Detail record. Detail data must
+    be read in this mode by the detail reader (see setDetailReader), which is called for every record. Failure of the detail
+    reader fails reading of the record. Records of the left join without Detail data are skipped by the detail reader if
+    the detail null reader is set (see setDetailNullReader).
+
     Template parameters.
 
     Dataset - see DBReader.
@@ -57,20 +64,52 @@ template <class Dataset, class Object, class Container, class Key>
 class DBReader2Associative : public DBReader2ContainerWithKey<Dataset, Object, Container, Key> {
 private:
     typedef DBReader2ContainerWithKey<Dataset, Object, Container, Key> AncestorType;
+    typename AncestorType::Reader2ObjectType* m_detailReader;
+    DBReader2Object<Dataset, bool>* m_detailNullReader;
+    bool m_detailIsNull;
+    bool m_readOnce;
 protected:
     /*!
         The objectByKey objectByKey method must be implemented in the descendants. It must find the Object instance by the Key value
         and return pointer to it. If container doesn't has Object with the Key value, objectByKey must add Object instance to the container
         and return pointer to it.
         @param key Key value for required Object instance.
-        @return Pointer to Object instance.
+        @return Pointer to Object instance or nullptr if Object instance can't be provided for the Key value. In the last case
+        reading fails.
     */
     virtual Object* objectByKey(const Key& key) = 0;
+    /*!
+        The objectByKey method like the one above that also reports whether the Object instance was created. It is used by read.
+        Descendants should override it to support the read once mode. The default implementation calls objectByKey(key) and
+        reports that the Object instance was created, so Object data is read from every record.
+        @param key Key value for required Object instance.
+        @param[out] created Set to true if the Object instance was added to the container by this call.
+        @return Pointer to Object instance or nullptr if Object instance can't be provided for the Key value.
+    */
+    virtual Object* objectByKey(const Key& key, bool& created)
+    {
+        created = true;
+        return objectByKey(key);
+    };
+private:
+    bool readDetail(Dataset& ds, Object* obj)
+    {
+        if (m_detailNullReader != nullptr) {
+            m_detailNullReader->setObject(&m_detailIsNull);
+            if (!m_detailNullReader->read(ds))
+                return false;
+            if (m_detailIsNull)
+                return true;
+        }
+        m_detailReader->setObject(obj);
+        return m_detailReader->read(ds);
+    };
 public:
     /*!
         Constructs DBReader2Associative without assosiated container and DBReader2Object instances for Key and Object.
     */
-    DBReader2Associative() : DBReader2ContainerWithKey<Dataset, Object, Container, Key>() {};
+    DBReader2Associative() : DBReader2ContainerWithKey<Dataset, Object, Container, Key>(), m_detailReader(nullptr),
+        m_detailNullReader(nullptr), m_detailIsNull(false), m_readOnce(false) {};
     /*!
         Constructs DBReader2Associative with assosiated container and DBReader2Object instances for Key and Object.
         @param[in] container Pointer to the Associative container that is used to store read data. The DBReader2Associative doesn't take
@@ -81,10 +120,75 @@ public:
         doesn't take ownership of the keyReader.
     */
     DBReader2Associative(Container* data, typename AncestorType::Reader2ObjectType* objectReader, typename AncestorType::Reader2KeyType* keyReader) :
-        DBReader2ContainerWithKey<Dataset, Object, Container, Key>(data, objectReader, keyReader) {};
+        DBReader2ContainerWithKey<Dataset, Object, Container, Key>(data, objectReader, keyReader), m_detailReader(nullptr),
+        m_detailNullReader(nullptr), m_detailIsNull(false), m_readOnce(false) {};
+    /*!
+        Get the read once mode.
+        @return True if Object data is read only when Object instance is created.
+    */
+    bool readOnce() const {return m_readOnce;};
+    /*!
+        Set the read once mode.
+        @param[in] readOnce If true, Object data is read with the object reader only from the record that creates Object instance.
+        If false (default), Object data is read from every record. Object instances that were already stored in the container
+        before reading (for example, in the map that wasn't cleared) aren't created by objectByKey, so in the read once mode
+        their data is never read again. Clear the container before reading in this mode.
+    */
+    void setReadOnce(bool readOnce) {m_readOnce = readOnce;};
+    /*!
+        Get the detail reader.
+        @return Pointer to the detail reader or nullptr if it wasn't assosiated.
+    */
+    typename AncestorType::Reader2ObjectType* detailReader() {return m_detailReader;};
+    /*!
+        Assosiates the detail reader. The detail reader is called for every record after the object reader (or instead of it in
+        the read once mode) with the Object instance for the Key value, for example to add Detail object to the container of
+        the Object instance. If the detail reader fails, reading of the record fails, so set the detail null reader (see
+        setDetailNullReader) to skip records of the left join without Detail data.
+        @param[in] reader Pointer to the detail reader or nullptr. The DBReader2Associative doesn't take ownership of reader.
+    */
+    void setDetailReader(typename AncestorType::Reader2ObjectType* reader) {m_detailReader = reader;};
+    /*!
+        Get the detail null reader.
+        @return Pointer to the detail null reader or nullptr if it wasn't assosiated.
+    */
+    DBReader2Object<Dataset, bool>* detailNullReader() {return m_detailNullReader;};
+    /*!
+        Assosiates the reader of the flag that shows whether the record has no Detail data, for example DBSqliteNullReader
+        for the Detail key column. If the flag is true, the detail reader isn't called for the record.
+        @param[in] reader Pointer to the detail null reader or nullptr. The DBReader2Associative doesn't take ownership of reader.
+    */
+    void setDetailNullReader(DBReader2Object<Dataset, bool>* reader) {m_detailNullReader = reader;};
+    /*!
+        Passes the call to the assosiated readers, including the detail reader.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        AncestorType::begin(ds);
+        if (m_detailReader != nullptr)
+            m_detailReader->begin(ds);
+        if (m_detailNullReader != nullptr)
+            m_detailNullReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated readers, including the detail reader.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        if (m_detailReader != nullptr)
+            m_detailReader->end(ds, ok);
+        if (m_detailNullReader != nullptr)
+            m_detailNullReader->end(ds, ok);
+    };
     /*!
         Creates instance of Key and reads data from Dataset instance current record to it using m_keyReader. Gains accsses to the Object instance using
-        objectByKey and reads data to the Object instance using m_objectReader.
+        objectByKey and reads data to the Object instance using m_objectReader, unless the read once mode is set and the Object instance already
+        existed. Then passes the Object instance to the detail reader, unless the detail null reader reports that the record
+        has no Detail data.
         @param[in] ds Dataset to read from.
         @return Returns true if success.
     */
@@ -98,8 +202,19 @@ public:
 
         AncestorType::m_keyReader->setObject(&k);
         if (AncestorType::m_keyReader->read(ds)) {
-            AncestorType::m_objectReader->setObject(objectByKey(k));
-            result = AncestorType::m_objectReader->read(ds);
+            bool created = false;
+            Object* obj = objectByKey(k, created);
+            if (obj != nullptr) {
+                if (created || !m_readOnce) {
+                    AncestorType::m_objectReader->setObject(obj);
+                    result = AncestorType::m_objectReader->read(ds);
+                }
+                else {
+                    result = true;
+                }
+                if (result && (m_detailReader != nullptr))
+                    result = readDetail(ds, obj);
+            }
         }
         return result;
     };    
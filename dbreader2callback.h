@@ -0,0 +1,173 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBREADER2CALLBACK_H
+#define DBREADER2CALLBACK_H
+
+#include <cstddef>
+#include <functional>
+#include "dbreader.h"
+#include "dbread2object.h"
+
+namespace dbframework {
+
+/*!
+    The DBReader2Callback template class is the DBReader descendant that passes every record of the SQL query execution
+    result to the callable object instead of storing records in the container. Every record is read to the same Object
+    instance owned by DBReader2Callback using DBReader2Object descendant, so reading the result of any size requires
+    constant memory. It is useful for exports and aggregations, when every record is needed only once.
+
+    Object instance isn't cleared between records, so the Object reader must assign every field it reads (including
+    the fields for NULL values), or setClearObject must be used to assign default constructed Object before reading
+    every record. Keeping the Object instance allows its members, for example strings, to reuse allocated memory.
+
+    The callable object may stop reading by returning false. Then readRow returns DBReadStatus::Stop, so DBSQLExecutor::exec
+    stops iteration without fetching more records and succeeds. When DBReader2Callback is used as a nested reader, read
+    returns false in this case; use stopped to distinguish stop requested by the callable object from reading failure.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object is the class which instance is used to store data of the current record. Must have default constructor.
+
+    Callback is the type of callable object that is called as bool callback(Object& obj) for every record. It must return
+    true to continue reading or false to stop.
+*/
+template <class Dataset, class Object, class Callback = std::function<bool(Object&)> >
+class DBReader2Callback : public DBReader<Dataset> {
+public:
+    /*!
+        Type of the DBReader descendant used to read data and store it in the Object instance.
+    */
+    typedef DBReader2Object<Dataset, Object> Reader2ObjectType;
+private:
+    Object m_object;
+    Reader2ObjectType* m_objectReader;
+    Callback m_callback;
+    size_t m_count;
+    bool m_stopped;
+    bool m_clearObject;
+public:
+    /*!
+        Constructs DBReader2Callback.
+        @param[in] reader Pointer to the Reader2ObjectType instance used to read Object data. DBReader2Callback doesn't take
+        ownership of the reader.
+        @param[in] callback Callable object that receives every record.
+    */
+    DBReader2Callback(Reader2ObjectType* reader, const Callback& callback = Callback()) : DBReader<Dataset>(),
+        m_objectReader(reader), m_callback(callback), m_count(0), m_stopped(false), m_clearObject(false) {};
+    /*!
+        Get Reader2ObjectType instance used to read Object data.
+        @return Pointer to Reader2ObjectType instance.
+    */
+    Reader2ObjectType* reader() {return m_objectReader;};
+    /*!
+        Assosiate Reader2ObjectType instance used to read Object data with DBReader2Callback instance.
+        @param[in] reader Pointer Reader2ObjectType instance. DBReader2Callback doesn't take ownership of reader.
+    */
+    void setReader(Reader2ObjectType* reader) {m_objectReader = reader;};
+    /*!
+        Get callable object.
+        @return Reference to the callable object.
+    */
+    Callback& callback() {return m_callback;};
+    /*!
+        Set callable object.
+        @param[in] callback Callable object that receives every record.
+    */
+    void setCallback(const Callback& callback) {m_callback = callback;};
+    /*!
+        Check if default constructed Object is assigned before reading every record.
+        @return True if Object is cleared.
+    */
+    bool clearObject() const {return m_clearObject;};
+    /*!
+        Set if default constructed Object must be assigned before reading every record. Default is false.
+        @param[in] clear True to clear Object before reading every record.
+    */
+    void setClearObject(bool clear) {m_clearObject = clear;};
+    /*!
+        Get the number of records passed to the callable object since the last SQL query execution result.
+        @return The number of records.
+    */
+    size_t count() const {return m_count;};
+    /*!
+        Check if the callable object stopped reading of the last SQL query execution result.
+        @return True if reading was stopped by the callable object.
+    */
+    bool stopped() const {return m_stopped;};
+    /*!
+        Resets the counter of records and stopped flag and passes the call to the assosiated Reader2ObjectType instance.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        m_count = 0;
+        m_stopped = false;
+        if (m_objectReader != nullptr)
+            m_objectReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated Reader2ObjectType instance.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        if (m_objectReader != nullptr)
+            m_objectReader->end(ds, ok);
+    };
+    /*!
+        Reads data to the Object instance using Reader2ObjectType instance and passes it to the callable object.
+        @param[in] ds Dataset to read from.
+        @return True if success and the callable object returned true.
+    */
+    bool read(Dataset& ds)
+    {
+        if (m_objectReader == nullptr)
+            return false;
+
+        if (m_clearObject)
+            m_object = Object();
+        m_objectReader->setObject(&m_object);
+        if (!m_objectReader->read(ds))
+            return false;
+
+        ++m_count;
+        m_stopped = !m_callback(m_object);
+        return !m_stopped;
+    };
+    /*!
+        Reads the record like read.
+        @param[in] ds Dataset to read from.
+        @return DBReadStatus::Stop if the callable object returned false, DBReadStatus::Failed if reading failed or
+        DBReadStatus::Continue otherwise.
+    */
+    DBReadStatus readRow(Dataset& ds)
+    {
+        if (read(ds))
+            return DBReadStatus::Continue;
+        return m_stopped ? DBReadStatus::Stop : DBReadStatus::Failed;
+    };
+};
+
+}
+
+#endif // DBREADER2CALLBACK_H
@@ -0,0 +1,123 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBREADER2COLUMNAR_H
+#define DBREADER2COLUMNAR_H
+
+#include <cstddef>
+#include <vector>
+#include "dbreader.h"
+#include "dbcolumnarcolumn.h"
+
+namespace dbframework {
+
+/*!
+    The DBReader2Columnar template class is the DBReader descendant that stores the SQL query execution result column by
+    column instead of storing it as the container of objects. Every column is stored in its own DBColumnarColumn instance
+    as contiguous chunks of typed values with the null bitmap, so the scan of one or two columns of a large result
+    doesn't load other fields to the processor cache.
+
+    The list of columns is set by calling addColumn once for every column, like the list of fields of the object
+    descriptor. All columns have the same number of values, equal to rowCount. If reading of some column fails, values of
+    the failed record are removed from all columns.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+*/
+template <class Dataset>
+class DBReader2Columnar : public DBReader<Dataset> {
+private:
+    std::vector<DBColumnarColumnBase<Dataset>*> m_columns;
+    size_t m_rowCount;
+public:
+    /*!
+        Constructs DBReader2Columnar without columns.
+    */
+    DBReader2Columnar() : DBReader<Dataset>(), m_rowCount(0) {};
+    /*!
+        Adds the column to the list of columns. Columns must be empty.
+        @param[in] column Pointer to the column. DBReader2Columnar doesn't take ownership of column.
+        @return The number of the column in the list.
+    */
+    size_t addColumn(DBColumnarColumnBase<Dataset>* column)
+    {
+        m_columns.push_back(column);
+        return m_columns.size() - 1;
+    };
+    /*!
+        Get the number of columns in the list.
+        @return The number of columns.
+    */
+    size_t columnCount() const {return m_columns.size();};
+    /*!
+        Get the number of read records.
+        @return The number of records stored in every column.
+    */
+    size_t rowCount() const {return m_rowCount;};
+    /*!
+        Removes all values from all columns.
+    */
+    void truncate()
+    {
+        for (DBColumnarColumnBase<Dataset>* c : m_columns)
+            c->truncate(0);
+        m_rowCount = 0;
+    };
+    /*!
+        Passes the call to all columns.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        for (DBColumnarColumnBase<Dataset>* c : m_columns)
+            c->begin(ds);
+    };
+    /*!
+        Passes the call to all columns.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        for (DBColumnarColumnBase<Dataset>* c : m_columns)
+            c->end(ds, ok);
+    };
+    /*!
+        Appends values of the current record to all columns.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        for (DBColumnarColumnBase<Dataset>* c : m_columns) {
+            if (!c->append(ds)) {
+                for (DBColumnarColumnBase<Dataset>* t : m_columns)
+                    t->truncate(m_rowCount);
+                return false;
+            }
+        }
+        ++m_rowCount;
+        return true;
+    };
+};
+
+}
+
+#endif // DBREADER2COLUMNAR_H
@@ -98,6 +98,9 @@ public:
             addToContainer(obj);
             result = true;
         }
+        else {
+            delete obj;
+        }
         return result;
     };   
 };
@@ -20,8 +20,10 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef DBREADER2CONTAINERBASE_H
 #define DBREADER2CONTAINERBASE_H
 
+#include <cstddef>
 #include "dbreader.h"
 #include "dbread2object.h"
+#include "dbreserve.h"
 
 namespace dbframework {
 
@@ -57,12 +59,14 @@ protected:
         Pointer to DBReader descendant used read data and store it in the Object instance.
      */
     Reader2ObjectType* m_objectReader;
+private:
+    size_t m_rowCountHint;
 public:
     /*!
         Constructs DBReader2ContainerBase without assosiated container and Reader2ObjectType instance.
     */
     DBReader2ContainerBase()
-        : DBReader<Dataset>(), m_container(nullptr), m_objectReader(nullptr) {};
+        : DBReader<Dataset>(), m_container(nullptr), m_objectReader(nullptr), m_rowCountHint(0) {};
     /*!
         Constructs DBReader2ContainerBase with assosiated container and Reader2ObjectType instance.
         @param[in] container Pointer to the container that is used to store read data. The DBReader2Container doesn't take
@@ -71,7 +75,7 @@ public:
         of the reader.
     */
     DBReader2ContainerBase(Container* container, Reader2ObjectType* reader)
-        : DBReader<Dataset>(), m_container(container), m_objectReader(reader) {};
+        : DBReader<Dataset>(), m_container(container), m_objectReader(reader), m_rowCountHint(0) {};
     /*!
         Get pointer to the container used to store data.
         @return Pointer to the container used to store data or nullptr if container wasn't assosiated.
@@ -94,6 +98,39 @@ public:
         @param[in] reader Pointer Reader2ObjectType instance. DBReader2Container doesn't take ownership of reader.
     */
     void setReader(Reader2ObjectType* reader) {m_objectReader = reader;};
+    /*!
+        Get the expected number of records.
+        @return The row count hint or zero if it is unknown.
+    */
+    size_t rowCountHint() const {return m_rowCountHint;};
+    /*!
+        Sets the expected number of records. The hint isn't passed to the assosiated Reader2ObjectType instance.
+        @param[in] count The expected number of records or zero if it is unknown.
+    */
+    void setRowCountHint(size_t count) {m_rowCountHint = count;};
+    /*!
+        Reserves space for the row count hint records in the assosiated container, if it has reserve method (see
+        reserveAdditional), and passes the call to the assosiated Reader2ObjectType instance. The hint is the expected number
+        of elements added to the container (see DBReader::resultSize).
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        if ((m_rowCountHint > 0) && (m_container != nullptr))
+            reserveAdditional(*m_container, m_rowCountHint);
+        if (m_objectReader != nullptr)
+            m_objectReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated Reader2ObjectType instance.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        if (m_objectReader != nullptr)
+            m_objectReader->end(ds, ok);
+    };
 };
 
 };
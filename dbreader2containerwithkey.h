@@ -40,6 +40,10 @@ namespace dbframework {
 
     Key is the type of the unique identifier of the Object. DBReader2ContainerWithKey descendants may impose restrictions
     on Key.
+
+    Records with the same Key value are stored in one element of the container, so the row count hint (see
+    DBReader::setRowCountHint) of DBReader2ContainerWithKey descendants is the expected number of elements added to the
+    container, and resultSize returns the number of elements added while reading the last result.
 */
 template <class Dataset, class Object, class Container, class Key>
 class DBReader2ContainerWithKey : public DBReader2ContainerBase<Dataset, Object, Container> {
@@ -53,11 +57,14 @@ protected:
         DBReader2Object descendant used to read unique identifier.
     */
     Reader2KeyType *m_keyReader;
+private:
+    typedef DBReader2ContainerBase<Dataset, Object, Container> AncestorType;
+    size_t m_sizeAtBegin;
 public:
     /*!
         Constructs DBReader2ContainerWithKey without assosiated container, Reader2ObjectType and Reader2KeyType instances.
     */
-    DBReader2ContainerWithKey() : DBReader2ContainerBase<Dataset, Object, Container>(), m_keyReader(nullptr) {};
+    DBReader2ContainerWithKey() : DBReader2ContainerBase<Dataset, Object, Container>(), m_keyReader(nullptr), m_sizeAtBegin(0) {};
     /*!
         Constructs DBReader2ContainerWithKey with assosiated container, Reader2ObjectType and Reader2KeyType instances.
         @param[in] container Pointer to the container that is used to store read data. The DBReader2ContainerWithKey doesn't take
@@ -69,7 +76,7 @@ public:
     */
     DBReader2ContainerWithKey(Container* data, typename DBReader2ContainerBase<Dataset, Object, Container>::Reader2ObjectType* objectReader,
         Reader2KeyType* keyReader) :
-        DBReader2ContainerBase<Dataset, Object, Container>(data, objectReader), m_keyReader(keyReader) {};
+        DBReader2ContainerBase<Dataset, Object, Container>(data, objectReader), m_keyReader(keyReader), m_sizeAtBegin(0) {};
     /*!
         Get assosiated Reader2KeyType instance.
         @return Pointer to the assosiated Reader2KeyType instance or nullptr if Reader2KeyType instance wasn't assosiated with this
@@ -81,6 +88,41 @@ public:
         @param[in] reader Pointer to the Reader2KeyType instance. The DBReader2ContainerWithKey doesn't take ownership of reader.
      */
     void setKeyReader(Reader2KeyType* reader) {m_keyReader = reader;};
+    /*!
+        Passes the call to the assosiated Reader2ObjectType and Reader2KeyType instances and remembers the size of the
+        container to calculate resultSize.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        m_sizeAtBegin = (AncestorType::m_container != nullptr) ? containerSize(*AncestorType::m_container, 0) : 0;
+        DBReader2ContainerBase<Dataset, Object, Container>::begin(ds);
+        if (m_keyReader != nullptr)
+            m_keyReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated Reader2ObjectType and Reader2KeyType instances.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        DBReader2ContainerBase<Dataset, Object, Container>::end(ds, ok);
+        if (m_keyReader != nullptr)
+            m_keyReader->end(ds, ok);
+    };
+    /*!
+        Get the number of elements added to the container while reading the last SQL query execution result.
+        @param[in] rows The number of records read. It is returned if Container doesn't have size method.
+        @return The number of elements added to the container.
+    */
+    size_t resultSize(size_t rows) const
+    {
+        if (AncestorType::m_container == nullptr)
+            return rows;
+        size_t size = containerSize(*AncestorType::m_container, m_sizeAtBegin + rows);
+        return (size > m_sizeAtBegin) ? size - m_sizeAtBegin : 0;
+    };
 };
 
 }
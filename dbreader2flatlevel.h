@@ -0,0 +1,252 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBREADER2FLATLEVEL_H
+#define DBREADER2FLATLEVEL_H
+
+#include <cstddef>
+#include <vector>
+#include "dbreader2containerwithkey.h"
+
+namespace dbframework {
+
+/*!
+    The DBFlatRange structure describes the children of one object of DBReader2FlatLevel: they are stored in the container
+    of the child level at positions from first to first + count - 1.
+*/
+struct DBFlatRange {
+    /*!
+        Index of the first child in the container of the child level.
+    */
+    size_t first;
+    /*!
+        The number of children.
+    */
+    size_t count;
+};
+
+/*!
+    The DBReader2FlatLevel template class reads one level of the hierarchy of objects from the SQL query execution result
+    containing fields from joined tables related as one-to-many, for example customers, their accounts and transactions of
+    accounts. Unlike nested DBReader2Associative descendants, that build the tree of objects with their own containers of
+    smart pointers, every level is stored by value in one contiguous container, and children of every object are
+    referenced by DBFlatRange with their position in the container of the child level. Traversal of the hierarchy reads
+    consecutive memory of every level instead of following pointers.
+
+    Levels are linked with setChild. The reader of the top level is passed to DBSQLExecutor::exec, and every level passes
+    the record to its child level after reading, so the whole hierarchy is built in a single pass. Failure of the child
+    level fails reading of the record. Records of the left join without details have NULL key of the child level: set the
+    null key reader of the child level (see setNullKeyReader), so that such records are skipped by it and by its children
+    instead of failing.
+
+    All records of the same object must be consecutive, and all records of children of the same object must be consecutive
+    too. Sort SQL query execution result by keys of all levels from the top level to the bottom (for example, "order by
+    customer.id, account.id, tran.id"). The object is added to the container when its Key value differs from the Key value
+    of the previous record or when the parent object changes. The object data is read only from the first record of
+    the object.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2ContainerBase. Must have default constructor.
+
+    Key is the type of the unique key used to identify instances of Object. If Key is a class then it must have default
+    constructor, assignment operator and operator ==.
+
+    Container is the class implementing container of Object with push_back, pop_back, back, size and clear methods, for example
+    std::vector.
+*/
+template <class Dataset, class Object, class Key, class Container = std::vector<Object> >
+class DBReader2FlatLevel : public DBReader2ContainerWithKey<Dataset, Object, Container, Key> {
+private:
+    typedef DBReader2ContainerWithKey<Dataset, Object, Container, Key> AncestorType;
+    std::vector<DBFlatRange> m_children;
+    DBReader2Object<Dataset, bool>* m_nullKeyReader;
+    bool m_keyIsNull;
+    std::vector<DBFlatRange>* m_parentRanges;
+    DBReader<Dataset>* m_child;
+    Key m_key;
+    Key m_lastKey;
+    size_t m_lastParent;
+    bool m_hasLast;
+public:
+    /*!
+        Constructs DBReader2FlatLevel without assosiated container and DBReader2Object instances for Key and Object.
+    */
+    DBReader2FlatLevel() : AncestorType(), m_nullKeyReader(nullptr), m_keyIsNull(false), m_parentRanges(nullptr),
+        m_child(nullptr), m_key(), m_lastKey(), m_lastParent(0), m_hasLast(false) {};
+    /*!
+        Constructs DBReader2FlatLevel with assosiated container and DBReader2Object instances for Key and Object.
+        @param[in] container Pointer to the container that is used to store objects of the level. The DBReader2FlatLevel
+        doesn't take ownership of container.
+        @param[in] objectReader Pointer to the DBReader2Object descendant instance that is used read Object data. The
+        DBReader2FlatLevel doesn't take ownership of the objectReader.
+        @param[in] keyReader Pointer to the DBReader2Object descendant instance that is used to read Key data. The
+        DBReader2FlatLevel doesn't take ownership of the keyReader.
+    */
+    DBReader2FlatLevel(Container* container, typename AncestorType::Reader2ObjectType* objectReader,
+        typename AncestorType::Reader2KeyType* keyReader) :
+        AncestorType(container, objectReader, keyReader), m_nullKeyReader(nullptr), m_keyIsNull(false), m_parentRanges(nullptr),
+        m_child(nullptr), m_key(), m_lastKey(), m_lastParent(0), m_hasLast(false) {};
+    /*!
+        Get the reader of the NULL key flag.
+        @return Pointer to the DBReader2Object instance used to read the NULL key flag or nullptr if it isn't set.
+    */
+    DBReader2Object<Dataset, bool>* nullKeyReader() {return m_nullKeyReader;};
+    /*!
+        Sets the reader of the flag that shows whether the Key of the record is NULL, for example DBSqliteNullReader for the
+        key column. If the flag is true, the record has no object of this level and is skipped by this level and its children.
+        Without the null key reader the record with NULL key fails reading if the key reader fails to read it.
+        @param[in] reader Pointer to the DBReader2Object instance used to read the NULL key flag or nullptr. The
+        DBReader2FlatLevel doesn't take ownership of reader.
+    */
+    void setNullKeyReader(DBReader2Object<Dataset, bool>* reader) {m_nullKeyReader = reader;};
+    /*!
+        Links the child level to this level. The child level must not be linked to other levels.
+        @param[in] child Pointer to the child level or nullptr. The DBReader2FlatLevel doesn't take ownership of child.
+    */
+    template <class ChildObject, class ChildKey, class ChildContainer>
+    void setChild(DBReader2FlatLevel<Dataset, ChildObject, ChildKey, ChildContainer>* child)
+    {
+        if (child != nullptr)
+            child->setParentRanges(&m_children);
+        m_child = child;
+    };
+    /*!
+        Sets the ranges of children of the parent level. It is called by setChild of the parent level.
+        @param[in] ranges Pointer to the ranges of children of the parent level.
+    */
+    void setParentRanges(std::vector<DBFlatRange>* ranges) {m_parentRanges = ranges;};
+    /*!
+        Get the ranges of children of all objects of the level. The range of the object has the same index as the object in
+        the container.
+        @return Ranges of children.
+    */
+    const std::vector<DBFlatRange>& children() const {return m_children;};
+    /*!
+        Get the range of children of the object.
+        @param[in] index Index of the object in the container.
+        @return Range of children in the container of the child level.
+    */
+    const DBFlatRange& children(size_t index) const {return m_children[index];};
+    /*!
+        Forgets the Key value of the last record, so the next record starts new object even if its Key value is the same.
+        It is called by begin for every SQL query execution result.
+    */
+    void clearLast() {m_hasLast = false;};
+    /*!
+        Removes all objects from the container and all ranges of children. Call this method for all levels when reading new
+        hierarchy.
+    */
+    void clear()
+    {
+        if (AncestorType::m_container != nullptr)
+            AncestorType::m_container->clear();
+        m_children.clear();
+        m_hasLast = false;
+    };
+    /*!
+        Reserves space for the row count hint objects in the container and their ranges of children, and passes the call
+        to the assosiated readers, including the null key reader, and to the child level. The hint isn't passed to the child
+        level.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        AncestorType::begin(ds);
+        if (m_nullKeyReader != nullptr)
+            m_nullKeyReader->begin(ds);
+        if (AncestorType::rowCountHint() > 0)
+            m_children.reserve(m_children.size() + AncestorType::rowCountHint());
+        if (m_child != nullptr)
+            m_child->begin(ds);
+        m_hasLast = false;
+    };
+    /*!
+        Passes the call to the assosiated readers, including the null key reader, and to the child level.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        if (m_nullKeyReader != nullptr)
+            m_nullKeyReader->end(ds, ok);
+        if (m_child != nullptr)
+            m_child->end(ds, ok);
+    };
+    /*!
+        Reads Key value of the current record. If it starts new object, adds Object instance to the container, reads data to
+        it and adds it to the range of children of the parent object. Then passes the record to the child level. If the null
+        key reader reports NULL key, the record is skipped.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success or the record is skipped, false if this level or the child level fails.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((AncestorType::m_keyReader == nullptr) || (AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        if (m_nullKeyReader != nullptr) {
+            m_nullKeyReader->setObject(&m_keyIsNull);
+            if (!m_nullKeyReader->read(ds))
+                return false;
+            if (m_keyIsNull)
+                return true;
+        }
+
+        AncestorType::m_keyReader->setObject(&m_key);
+        if (!AncestorType::m_keyReader->read(ds))
+            return false;
+
+        size_t parent = (m_parentRanges != nullptr) ? m_parentRanges->size() : 0;
+        if (!m_hasLast || (parent != m_lastParent) || !(m_key == m_lastKey)) {
+            if ((m_parentRanges != nullptr) && m_parentRanges->empty())
+                return false;
+
+            Container& c = *AncestorType::m_container;
+            c.push_back(Object());
+            AncestorType::m_objectReader->setObject(&c.back());
+            if (!AncestorType::m_objectReader->read(ds)) {
+                c.pop_back();
+                m_hasLast = false;
+                return false;
+            }
+
+            DBFlatRange range = {0, 0};
+            m_children.push_back(range);
+            if (m_parentRanges != nullptr) {
+                DBFlatRange& r = m_parentRanges->back();
+                if (r.count == 0)
+                    r.first = c.size() - 1;
+                ++r.count;
+            }
+            m_lastKey = m_key;
+            m_lastParent = parent;
+            m_hasLast = true;
+        }
+
+        return (m_child == nullptr) || m_child->read(ds);
+    };
+};
+
+}
+
+#endif // DBREADER2FLATLEVEL_H
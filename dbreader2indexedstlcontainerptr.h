@@ -21,6 +21,8 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define DBREADER2INDEXEDSTLCONTAINERPTR_H
 
 #include "dbreader2associative.h"
+#include "dbobjectfactory.h"
+#include "dbreserve.h"
 
 namespace dbframework {
 
@@ -56,22 +58,29 @@ namespace dbframework {
     pointer Object* can be used as ObjectPtr too, but care must be taken to deallocate elements before
     destruction of the container.
 
-    Index is the associative container of pairs <Key, ObjectPtr> from STL library (for example, std::map<Key, ObjectPtr>) or
-    compatible container. Compatibility means that container must have
-    overloaded operator ObjectPtr& operator[](const Key& k) which returns ObjectPtr reference associated with the Key value.
-    If there is no ObjectPtr instance associated with the Key value, than operator must add one to the container and return
-    reference to it.
+    Index is the associative container of pairs <Key, ObjectPtr> from STL library (for example, std::map<Key, ObjectPtr> or
+    std::unordered_map<Key, ObjectPtr>) or compatible container, for example open addressing hash map. Compatibility means
+    that container must have overloaded operator ObjectPtr& operator[](const Key& k) which returns ObjectPtr reference associated
+    with the Key value. If there is no ObjectPtr instance associated with the Key value, than operator must add one to the container
+    and return reference to it. Hash maps are usually faster than std::map for large results. If Index has reserve method, then
+    reserveIndex can be used to avoid rehashing.
+
+    Factory is the class used to create Object instances, see DBNewObjectFactory. Use DBSharedObjectFactory to
+    allocate Object instances with allocator, for example from the memory pool.
 */
-template <class Dataset, class Object, class Container, class Key, class ObjectPtr, class Index>
+template <class Dataset, class Object, class Container, class Key, class ObjectPtr, class Index,
+    class Factory = DBNewObjectFactory<Object, ObjectPtr> >
 class DBReader2IndexedSTLContainerPtr : public DBReader2Associative<Dataset, Object, Container, Key> {
 private:
     typedef DBReader2Associative<Dataset, Object, Container, Key> AncestorType;    
     Index m_index;
+    Factory m_factory;
+    bool m_keepIndex;
 public:
     /*!
         Constructs DBReader2IndexedSTLContainerPtr without assosiated container and DBReader2Object instances for Key and Object.
     */
-    DBReader2IndexedSTLContainerPtr() : DBReader2Associative<Dataset, Object, Container, Key>() {};
+    DBReader2IndexedSTLContainerPtr() : DBReader2Associative<Dataset, Object, Container, Key>(), m_keepIndex(false) {};
     /*!
         Constructs DBReader2IndexedSTLContainerPtr with assosiated container and DBReader2Object instances for Key and Object.
         @param[in] container Pointer to the Associative container that is used to store read data. The DBReader2IndexedContainer doesn't take
@@ -80,28 +89,90 @@ public:
         doesn't take ownership of the objectReader.
         @param[in] keyReader Pointer to the DBReader2Object descendant instance that is used to read Key data. The DBReader2IndexedContainer
         doesn't take ownership of the keyReader.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBReader2IndexedSTLContainerPtr(Container* data, typename AncestorType::Reader2ObjectType* objectReader, typename AncestorType::Reader2KeyType* keyReader,
+        const Factory& factory = Factory()) :
+        DBReader2Associative<Dataset, Object, Container, Key>(data, objectReader, keyReader), m_factory(factory), m_keepIndex(false) {};
+    /*!
+        Get factory used to create Object instances.
+        @return Reference to the factory.
     */
-    DBReader2IndexedSTLContainerPtr(Container* data, typename AncestorType::Reader2ObjectType* objectReader, typename AncestorType::Reader2KeyType* keyReader) :
-        DBReader2Associative<Dataset, Object, Container, Key>(data, objectReader, keyReader) {};
+    Factory& factory() {return m_factory;};
     /*!
-        Clears internal index. Call this method after reading each SQL query results when reusing same DBReader2IndexedSTLContainerPtr instance for multiple queries.
+        Clears internal index. The index is cleared automatically by end unless keepIndex is set.
     */
     void clearIndex()
     {
         m_index = Index();
     };
+    /*!
+        Reserves space in the internal index for the expected number of Key values. Does nothing if Index doesn't have
+        reserve method.
+        @param[in] count Expected number of Key values.
+    */
+    void reserveIndex(size_t count)
+    {
+        reserveContainer(m_index, count);
+    };
+    /*!
+        Get the mode of internal index releasing.
+        @return True if the index is kept after reading SQL query execution result.
+    */
+    bool keepIndex() const {return m_keepIndex;};
+    /*!
+        Set the mode of internal index releasing.
+        @param[in] keep If false (default), the index is released by end after reading each SQL query execution result. If true,
+        the index is kept, so that results of several queries can be merged in the same container, and clearIndex must be called
+        to release it.
+    */
+    void setKeepIndex(bool keep) {m_keepIndex = keep;};
+    /*!
+        Reserves space in the container and in the internal index for the row count hint records and passes the call to
+        the assosiated readers.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        AncestorType::begin(ds);
+        if (AncestorType::rowCountHint() > 0)
+            reserveIndex(AncestorType::rowCountHint());
+    };
+    /*!
+        Passes the call to the assosiated readers and releases internal index unless keepIndex is set.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        if (!m_keepIndex)
+            clearIndex();
+    };
 protected:    
     /*!
         The DBReader2IndexedSTLContainerPtr implements objectByKey method using Index's operator [] and Container's method push_back.
+        Index is searched once for every Key value and ObjectPtr stored in the index isn't copied if it is found.
         @param key Key value for required Object instance.
         @return Pointer to Object instance.
     */
     Object* objectByKey(const Key& key)
     {
-        ObjectPtr p = m_index[key];
-        if (p == nullptr) {
-            p = ObjectPtr(new Object);
-            m_index[key] = p;
+        bool created;
+        return objectByKey(key, created);
+    };
+    /*!
+        Implements objectByKey like the method above and reports whether the Object instance was created.
+        @param key Key value for required Object instance.
+        @param[out] created Set to true if the Object instance was created and added to the container.
+        @return Pointer to Object instance.
+    */
+    Object* objectByKey(const Key& key, bool& created)
+    {
+        ObjectPtr& p = m_index[key];
+        created = p == nullptr;
+        if (created) {
+            p = m_factory.create();
             AncestorType::m_container->push_back(p);
         }
         return &(*p);
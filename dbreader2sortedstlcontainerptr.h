@@ -0,0 +1,174 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBREADER2SORTEDSTLCONTAINERPTR_H
+#define DBREADER2SORTEDSTLCONTAINERPTR_H
+
+#include <cassert>
+#include <functional>
+#include "dbreader2associative.h"
+#include "dbobjectfactory.h"
+
+namespace dbframework {
+
+/*!
+    The DBReader2SortedSTLContainerPtr template class is the replacement of DBReader2IndexedSTLContainerPtr for SQL queries
+    whose results are sorted by the Key value (for example, with "order by" clause on the key field of the Master table).
+    For such results all records with the same Key value are consecutive, so the DBReader2SortedSTLContainerPtr doesn't
+    need an index. It remembers only the last Key value and Object instance: if the Key value of the current record is equal
+    to the last one, the data is read to the last Object instance, otherwise new Object instance is added to the end of the
+    container. Every record costs one Key comparison and no memory is used except the container.
+
+    DBReader2SortedSTLContainerPtr checks that Key values go in the order defined by Compare. If the Key value of the
+    current record precedes the last one, reading fails. With setCheckOrder(false) this check is replaced by assert.
+
+    When DBReader2SortedSTLContainerPtr is used as nested reader and the container is changed with setContainer, the last
+    Key value is forgotten, so records of different containers are never merged.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2ContainerBase.
+
+    Container is the class implementing container of ObjectPtr. Container must have push_back(const ObjectPtr& ) method that
+    adds ObjectPtr to the container.
+
+    Key is the type of the unique key used to identify instances of Object. If Key is a class then it must have default
+    constructor, assignment operator and operator ==.
+
+    ObjectPtr - see DBReader2STLContainerPtr.
+
+    Compare is the binary predicate that defines the order of Key values in SQL query execution result. Compare(a, b) must
+    return true if a precedes b. Default is std::less<Key> (ascending order).
+
+    Factory - see DBReader2STLContainerPtr.
+*/
+template <class Dataset, class Object, class Container, class Key, class ObjectPtr, class Compare = std::less<Key>,
+    class Factory = DBNewObjectFactory<Object, ObjectPtr> >
+class DBReader2SortedSTLContainerPtr : public DBReader2Associative<Dataset, Object, Container, Key> {
+private:
+    typedef DBReader2Associative<Dataset, Object, Container, Key> AncestorType;
+    Key m_lastKey;
+    Object* m_last;
+    Container* m_lastContainer;
+    Compare m_compare;
+    Factory m_factory;
+    bool m_checkOrder;
+public:
+    /*!
+        Constructs DBReader2SortedSTLContainerPtr without assosiated container and DBReader2Object instances for Key and Object.
+    */
+    DBReader2SortedSTLContainerPtr() : DBReader2Associative<Dataset, Object, Container, Key>(),
+        m_lastKey(), m_last(nullptr), m_lastContainer(nullptr), m_checkOrder(true) {};
+    /*!
+        Constructs DBReader2SortedSTLContainerPtr with assosiated container and DBReader2Object instances for Key and Object.
+        @param[in] container Pointer to the container that is used to store read data. The DBReader2SortedSTLContainerPtr doesn't take
+        ownership of container.
+        @param[in] objectReader Pointer to the DBReader2Object descendant instance that is used read Object data. The DBReader2SortedSTLContainerPtr
+        doesn't take ownership of the objectReader.
+        @param[in] keyReader Pointer to the DBReader2Object descendant instance that is used to read Key data. The DBReader2SortedSTLContainerPtr
+        doesn't take ownership of the keyReader.
+        @param[in] compare Predicate that defines the order of Key values.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBReader2SortedSTLContainerPtr(Container* data, typename AncestorType::Reader2ObjectType* objectReader, typename AncestorType::Reader2KeyType* keyReader,
+        const Compare& compare = Compare(), const Factory& factory = Factory()) :
+        DBReader2Associative<Dataset, Object, Container, Key>(data, objectReader, keyReader),
+        m_lastKey(), m_last(nullptr), m_lastContainer(nullptr), m_compare(compare), m_factory(factory), m_checkOrder(true) {};
+    /*!
+        Get factory used to create Object instances.
+        @return Reference to the factory.
+    */
+    Factory& factory() {return m_factory;};
+    /*!
+        Get the mode of Key order checking.
+        @return True if wrong order of Key values makes reading fail, false if it is only asserted.
+    */
+    bool checkOrder() const {return m_checkOrder;};
+    /*!
+        Set the mode of Key order checking.
+        @param[in] check If true (default) wrong order of Key values makes reading fail. If false wrong order is detected with
+        assert only, so it isn't checked in release build.
+    */
+    void setCheckOrder(bool check) {m_checkOrder = check;};
+    /*!
+        Forgets the last Key value. It is called by end after reading each SQL query execution result.
+    */
+    void clearLast()
+    {
+        m_last = nullptr;
+        m_lastContainer = nullptr;
+    };
+    /*!
+        Passes the call to the assosiated readers and forgets the last Key value.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        clearLast();
+    };
+protected:
+    /*!
+        The DBReader2SortedSTLContainerPtr implements objectByKey method by comparing key with the last Key value. New Object
+        instance is added to the container with push_back.
+        @param key Key value for required Object instance.
+        @return Pointer to Object instance or nullptr if Key values are out of order.
+    */
+    Object* objectByKey(const Key& key)
+    {
+        bool created;
+        return objectByKey(key, created);
+    };
+    /*!
+        Implements objectByKey like the method above and reports whether the Object instance was created.
+        @param key Key value for required Object instance.
+        @param[out] created Set to true if the Object instance was created and added to the container.
+        @return Pointer to Object instance or nullptr if Key values are out of order.
+    */
+    Object* objectByKey(const Key& key, bool& created)
+    {
+        created = false;
+        if ((m_last != nullptr) && (m_lastContainer == AncestorType::m_container)) {
+            if (key == m_lastKey)
+                return m_last;
+            if (m_checkOrder) {
+                if (!m_compare(m_lastKey, key))
+                    return nullptr;
+            }
+            else {
+                assert(m_compare(m_lastKey, key));
+            }
+        }
+
+        ObjectPtr p = m_factory.create();
+        m_last = &(*p);
+        m_lastKey = key;
+        m_lastContainer = AncestorType::m_container;
+        AncestorType::m_container->push_back(p);
+        created = true;
+        return m_last;
+    };
+};
+
+}
+
+#endif // DBREADER2SORTEDSTLCONTAINERPTR_H
@@ -73,6 +73,19 @@ protected:
     {
         return &((*AncestorType::m_container)[key]);
     };
+    /*!
+        Implements objectByKey using Container's operator []. The Object instance is created if the size of the container changes.
+        @param key Key value for required Object instance.
+        @param[out] created Set to true if the Object instance was added to the container.
+        @return Pointer to Object instance.
+    */
+    Object* objectByKey(const Key& key, bool& created)
+    {
+        typename Container::size_type size = AncestorType::m_container->size();
+        Object* obj = &((*AncestorType::m_container)[key]);
+        created = AncestorType::m_container->size() != size;
+        return obj;
+    };
 
 };
 
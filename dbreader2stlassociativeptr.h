@@ -21,6 +21,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define DBREADER2STLASSOCIATIVEPTR_H
 
 #include "dbreader2associative.h"
+#include "dbobjectfactory.h"
 
 namespace dbframework {
 
@@ -47,11 +48,15 @@ namespace dbframework {
     ObjectPtr(Object* obj). The example of smart pointer is STL shared_ptr template class. Simple
     pointer Object* can be used as ObjectPtr too, but care must be taken to deallocate elements before
     destruction of the container.
+
+    Factory is the class used to create Object instances, see DBNewObjectFactory. Use DBSharedObjectFactory to
+    allocate Object instances with allocator, for example from the memory pool.
 */
-template <class Dataset, class Object, class Container, class Key, class ObjectPtr>
+template <class Dataset, class Object, class Container, class Key, class ObjectPtr, class Factory = DBNewObjectFactory<Object, ObjectPtr> >
 class DBReader2STLAssociativePtr : public DBReader2Associative<Dataset, Object, Container, Key> {
 private:
     typedef DBReader2Associative<Dataset, Object, Container, Key> AncestorType;
+    Factory m_factory;
 public:
     /*!
         Constructs DBReader2STLAssociative without assosiated container and DBReader2Object instances for Key and Object.
@@ -65,24 +70,43 @@ public:
         doesn't take ownership of the objectReader.
         @param[in] keyReader Pointer to the DBReader2Object descendant instance that is used to read Key data. The DBReader2STLAssociative
         doesn't take ownership of the keyReader.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBReader2STLAssociativePtr(Container* data, typename AncestorType::Reader2ObjectType* objectReader, typename AncestorType::Reader2KeyType* keyReader,
+        const Factory& factory = Factory()) :
+        DBReader2Associative<Dataset, Object, Container, Key>(data, objectReader, keyReader), m_factory(factory) {};
+    /*!
+        Get factory used to create Object instances.
+        @return Reference to the factory.
     */
-    DBReader2STLAssociativePtr(Container* data, typename AncestorType::Reader2ObjectType* objectReader, typename AncestorType::Reader2KeyType* keyReader) :
-        DBReader2Associative<Dataset, Object, Container, Key>(data, objectReader, keyReader) {};
+    Factory& factory() {return m_factory;};
 protected:
     /*!
-        The DBReader2STLAssociative implements objectByKey method using Container's operator [].
+        The DBReader2STLAssociative implements objectByKey method using Container's operator []. Container is searched once
+        for every Key value and ObjectPtr stored in the container isn't copied.
         @param key Key value for required Object instance.
         @return Pointer to Object instance.
     */
     Object* objectByKey(const Key& key)
     {
-        ObjectPtr p = (*AncestorType::m_container)[key];
-        if (p == nullptr) {
-            p = ObjectPtr(new Object);
-            (*AncestorType::m_container)[key] = p;
+        bool created;
+        return objectByKey(key, created);
+    };
+    /*!
+        Implements objectByKey like the method above and reports whether the Object instance was created.
+        @param key Key value for required Object instance.
+        @param[out] created Set to true if the Object instance was created.
+        @return Pointer to Object instance.
+    */
+    Object* objectByKey(const Key& key, bool& created)
+    {
+        ObjectPtr& p = (*AncestorType::m_container)[key];
+        created = p == nullptr;
+        if (created) {
+            p = m_factory.create();
         }
         return &(*p);
-    }
+    };
 
 };
 
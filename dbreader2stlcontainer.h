@@ -20,7 +20,11 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef DBREADER2STLCONTAINER_H
 #define DBREADER2STLCONTAINER_H
 
+#include <utility>
+#include <vector>
+#include "dbcontainerelement.h"
 #include "dbreader2container.h"
+#include "dbreserve.h"
 
 namespace dbframework {
 
@@ -30,6 +34,24 @@ namespace dbframework {
     that adds Object to the container. This group includes some containers from STL library
     (for example, std::vector) and Qt library (for example, QVector).
 
+    Unlike DBReader2Container, the DBReader2STLContainer doesn't allocate Object instance for every record. If Container
+    has emplace_back() and pop_back() methods (like std::vector, std::deque and std::list), then new element is constructed
+    in the container and data is read directly to it. If reading fails, the element is removed from the container.
+    Otherwise data is read to the temporary Object instance which is moved to the container with push_back.
+
+    In recycle mode (see setRecycle) the container isn't expected to be cleared before reading. When the first record is
+    read to the container, its elements are moved to the list of spare elements kept by DBReader2STLContainer and the
+    container is cleared. Then the data of every record is read to the spare element, if there is one, which is moved back
+    to the container, so that the element's memory (for example, string capacity) is reused. New elements are constructed
+    only when there are no spare elements left, and the spare elements left unused are destroyed by end. So once the list of
+    spare elements has grown, repeated reading of the results of the same size into the same containers allocates no memory. In recycle mode the Object reader must
+    assign every field it reads, and Container must also have operator[], size(), begin(), end() and erase(first, last)
+    methods (like std::vector, std::deque and QVector), otherwise recycle mode has no effect. When DBReader2STLContainer is
+    used to read details of the master objects and the container is changed with setContainer while reading, records of
+    every container must be consecutive in the result. The spare elements of one container are reused by the next ones, and
+    the previous container is never accessed after the change, so it may be moved or destroyed (for example, when the
+    container of master objects is reallocated). The container that doesn't receive any record is left unchanged.
+
     Template parameters.
 
     Dataset - see DBReader.
@@ -37,11 +59,49 @@ namespace dbframework {
     Object - see DBReader2Container.
 
     Container is the class implementing the container of Object. Container must have push_back(const Object& ) method
-    that adds Object to the container.
+    that adds Object to the container or emplace_back(), back() and pop_back() methods. See above for the additional
+    requirements of recycle mode.
 */
 template <class Dataset, class Object, class Container>
 class DBReader2STLContainer : public DBReader2Container<Dataset, Object, Container>
 {
+private:
+    typedef DBReader2Container<Dataset, Object, Container> AncestorType;
+    bool m_recycle;
+    size_t m_recycleReserve;
+    Container* m_recycleContainer;
+    std::vector<Object> m_spare;
+
+    template <class C>
+    auto release(C& container, int) -> decltype(container.erase(container.begin(), container.end()), container[0], void())
+    {
+        for (size_t i = container.size(); i > 0; --i)
+            m_spare.push_back(std::move(container[i - 1]));
+        container.erase(container.begin(), container.end());
+    };
+    template <class C>
+    void release(C&, long)
+    {
+    };
+    bool readRecycled(Dataset& ds)
+    {
+        Container& container = *AncestorType::m_container;
+        if (&container != m_recycleContainer) {
+            m_recycleContainer = &container;
+            release(container, 0);
+            if (m_recycleReserve > 0)
+                reserveContainer(container, m_recycleReserve);
+            m_recycleReserve = 0;
+        }
+        if (m_spare.empty())
+            return readContainerElement<Object>(container, *AncestorType::m_objectReader, ds);
+        AncestorType::m_objectReader->setObject(&m_spare.back());
+        if (!AncestorType::m_objectReader->read(ds))
+            return false;
+        container.push_back(std::move(m_spare.back()));
+        m_spare.pop_back();
+        return true;
+    };
 protected:
     /*!
         The DBReader2STLContainer implementation of addToContainer uses push_back to add new element to the container.
@@ -50,7 +110,7 @@ protected:
     void addToContainer(Object* obj)
     {
         if (obj != nullptr) {            
-            DBReader2Container<Dataset, Object, Container>::m_container->push_back(*obj);
+            AncestorType::m_container->push_back(std::move(*obj));
             delete obj;
         }
     }
@@ -58,7 +118,8 @@ public:
     /*!
         Constructs DBReader2STLContainer without assosiated container and DBReader2Object instance.
     */
-    DBReader2STLContainer():DBReader2Container<Dataset, Object, Container>(){};
+    DBReader2STLContainer():DBReader2Container<Dataset, Object, Container>(), m_recycle(false), m_recycleReserve(0),
+        m_recycleContainer(nullptr){};
     /*!
         Constructs DBReader2STLContainer with assosiated container and DBReader2Object instance.
         @param[in] container Pointer to the container that is used to store read data. The DBReader2Container doesn't take
@@ -67,7 +128,68 @@ public:
         of reader.
     */
     DBReader2STLContainer(Container* container, DBReader2Object<Dataset, Object>* reader):
-        DBReader2Container<Dataset, Object, Container>(container, reader){};
+        DBReader2Container<Dataset, Object, Container>(container, reader), m_recycle(false), m_recycleReserve(0),
+        m_recycleContainer(nullptr){};
+    /*!
+        Get the recycle mode.
+        @return True if the elements already stored in the container are reused.
+    */
+    bool recycle() const {return m_recycle;};
+    /*!
+        Set the recycle mode. Must not be changed while reading SQL query execution result.
+        @param[in] recycle If false (default), read data is added to the container. If true, the elements already stored
+        in the container are overwritten with read data and the surplus elements are destroyed by end.
+    */
+    void setRecycle(bool recycle) {m_recycle = recycle;};
+    /*!
+        Passes the call to the assosiated DBReader2Object instance and reserves space for the row count hint records. In
+        recycle mode the container isn't accessed until the first record is read, because the container assosiated with
+        the nested reader may be already destroyed, and the space is reserved by the first read for the row count hint records
+        in total, because the elements stored in the container are reused. The row count hint is set only for the top level
+        reader.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        if (!m_recycle) {
+            AncestorType::begin(ds);
+            return;
+        }
+        m_recycleContainer = nullptr;
+        m_spare.clear();
+        m_recycleReserve = AncestorType::rowCountHint();
+        if (AncestorType::m_objectReader != nullptr)
+            AncestorType::m_objectReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated DBReader2Object instance. In recycle mode destroys the spare elements, which
+        weren't overwritten with read data.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        m_recycleContainer = nullptr;
+        m_spare.clear();
+    };
+    /*!
+        The DBReader2STLContainer implementation of read method constructs new element in the container and reads data
+        directly to it using assosiated DBReader2Object instance. If Container doesn't support in-place construction,
+        data is read to the temporary Object instance that is moved to the container. In recycle mode data is read to the
+        spare element, if there is one.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        if (m_recycle)
+            return readRecycled(ds);
+        return readContainerElement<Object>(*AncestorType::m_container, *AncestorType::m_objectReader, ds);
+    };
 };
 
 }
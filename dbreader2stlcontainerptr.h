@@ -20,7 +20,11 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef DBREADER2STLCONTAINERPTR_H
 #define DBREADER2STLCONTAINERPTR_H
 
+#include <utility>
+#include <vector>
 #include "dbreader2container.h"
+#include "dbobjectfactory.h"
+#include "dbreserve.h"
 
 namespace dbframework {
 
@@ -31,6 +35,21 @@ namespace dbframework {
     (for example, std::vector) and Qt library (for example, QVector). Unlike DBReader2STLContainer, the
     DBReader2STLContainerPtr class operates with containers of smart pointers to Object.
 
+    In recycle mode (see setRecycle) the container isn't expected to be cleared before reading. When the first record is
+    read to the container, its elements are moved to the list of spare elements kept by DBReader2STLContainerPtr and the
+    container is cleared. Then the data of every record is read to the Object instance pointed by the spare element, if
+    there is one, which is moved back to the container, so neither Object instances nor their memory (for example, string
+    capacity) are allocated again. Object instance is kept as spare only if the factory reports that the element is reusable
+    (see DBNewObjectFactory), for example if the shared pointer isn't copied outside of the container, otherwise the element
+    is released with the factory's destroy method and replaced with the new Object instance, so that Object instances held
+    elsewhere never change. New Object instances are also created when there are no spare elements left, and the spare
+    elements left unused are released with the factory's destroy method by end. In recycle mode the Object reader must assign every field it reads, and Container must
+    also have operator[], size(), begin(), end() and erase(first, last) methods (like std::vector, std::deque and QVector),
+    otherwise recycle mode has no effect. When the container is changed with setContainer while reading, records of every
+    container must be consecutive in the result. The spare elements of one container are reused by the next ones, and the
+    previous container is never accessed after the change, so it may be moved or destroyed (for example, when the container
+    of master objects is reallocated). The container that doesn't receive any record is left unchanged.
+
     Template parameters.
 
     Dataset - see DBReader.
@@ -38,16 +57,83 @@ namespace dbframework {
     Object - see DBReader2Container.
 
     Container is the class implementing the container of ObjectPtr. Container must have
-    push_back(const ObjectPtr& ) method that adds ObjectPtr to the container.
+    push_back(const ObjectPtr& ) method that adds ObjectPtr to the container. See above for the additional requirements
+    of recycle mode.
 
     ObjectPtr is a class of smart pointer to Object. ObjectPtr must have constructor of the form
     ObjectPtr(Object* obj). The example of smart pointer is STL shared_ptr template class. Simple
     pointer Object* can be used as ObjectPtr too, but care must be taken to deallocate elements before
     destruction of the container.
+
+    Factory is the class used to create Object instances, see DBNewObjectFactory. Use DBSharedObjectFactory to
+    allocate Object instances with allocator, for example from the memory pool.
 */
-template <class Dataset, class Object, class Container, class ObjectPtr>
+template <class Dataset, class Object, class Container, class ObjectPtr, class Factory = DBNewObjectFactory<Object, ObjectPtr> >
 class DBReader2STLContainerPtr : public DBReader2Container<Dataset, Object, Container>
 {
+private:
+    typedef DBReader2Container<Dataset, Object, Container> AncestorType;
+    Factory m_factory;
+    bool m_recycle;
+    size_t m_recycleReserve;
+    Container* m_recycleContainer;
+    std::vector<ObjectPtr> m_spare;
+
+    template <class C>
+    auto release(C& container, int) -> decltype(container.erase(container.begin(), container.end()), container[0], void())
+    {
+        for (size_t i = container.size(); i > 0; --i) {
+            ObjectPtr& p = container[i - 1];
+            if (m_factory.reusable(p)) {
+                m_spare.push_back(std::move(p));
+            }
+            else {
+                m_factory.destroy(p);
+                m_spare.push_back(m_factory.create());
+            }
+        }
+        container.erase(container.begin(), container.end());
+    };
+    template <class C>
+    void release(C&, long)
+    {
+    };
+    void releaseSpare()
+    {
+        for (auto i = m_spare.begin(); i != m_spare.end(); ++i)
+            m_factory.destroy(*i);
+        m_spare.clear();
+    };
+    bool readRecycled(Dataset& ds)
+    {
+        Container& container = *AncestorType::m_container;
+        if (&container != m_recycleContainer) {
+            m_recycleContainer = &container;
+            release(container, 0);
+            if (m_recycleReserve > 0)
+                reserveContainer(container, m_recycleReserve);
+            m_recycleReserve = 0;
+        }
+        if (m_spare.empty())
+            return readElement(ds);
+        AncestorType::m_objectReader->setObject(&(*m_spare.back()));
+        if (!AncestorType::m_objectReader->read(ds))
+            return false;
+        container.push_back(std::move(m_spare.back()));
+        m_spare.pop_back();
+        return true;
+    };
+    bool readElement(Dataset& ds)
+    {
+        ObjectPtr p = m_factory.create();
+        AncestorType::m_objectReader->setObject(&(*p));
+        if (!AncestorType::m_objectReader->read(ds)) {
+            m_factory.destroy(p);
+            return false;
+        }
+        AncestorType::m_container->push_back(std::move(p));
+        return true;
+    };
 protected:
     /*!
         The DBReader2STLContainer implementation of addToContainer uses push_back to add new element to the container.
@@ -63,16 +149,84 @@ public:
     /*!
         Constructs DBReader2STLContainerPtr without assosiated container and DBReader2Object instance.
     */
-    DBReader2STLContainerPtr():DBReader2Container<Dataset, Object, Container>(){};
+    DBReader2STLContainerPtr():DBReader2Container<Dataset, Object, Container>(), m_recycle(false), m_recycleReserve(0),
+        m_recycleContainer(nullptr){};
     /*!
         Constructs DBReader2STLContainerPtr with assosiated container and DBReader2Object instance.
         @param[in] container Pointer to the container that is used to store read data. The DBReader2ContainerPtr doesn't take
         ownership of container.
         @param[in] reader Pointer to the DBReader2Object instance used to read Object data. DBReader2ContainerPtr doesn't take ownership
         of reader.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBReader2STLContainerPtr(Container* container, typename DBReader2Container<Dataset, Object, Container>::Reader2ObjectType* reader,
+        const Factory& factory = Factory()):
+        DBReader2Container<Dataset, Object, Container>(container, reader), m_factory(factory), m_recycle(false), m_recycleReserve(0),
+        m_recycleContainer(nullptr){};
+    /*!
+        Get factory used to create Object instances.
+        @return Reference to the factory.
+    */
+    Factory& factory() {return m_factory;};
+    /*!
+        Get the recycle mode.
+        @return True if Object instances already stored in the container are reused.
+    */
+    bool recycle() const {return m_recycle;};
+    /*!
+        Set the recycle mode. Must not be changed while reading SQL query execution result.
+        @param[in] recycle If false (default), read data is added to the container. If true, Object instances already stored
+        in the container are overwritten with read data and the surplus elements are released by end.
+    */
+    void setRecycle(bool recycle) {m_recycle = recycle;};
+    /*!
+        Passes the call to the assosiated DBReader2Object instance and reserves space for the row count hint records. In
+        recycle mode the container isn't accessed until the first record is read, because the container assosiated with
+        the nested reader may be already destroyed, and the space is reserved by the first read for the row count hint records
+        in total, because the elements stored in the container are reused. The row count hint is set only for the top level
+        reader.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        if (!m_recycle) {
+            AncestorType::begin(ds);
+            return;
+        }
+        m_recycleContainer = nullptr;
+        releaseSpare();
+        m_recycleReserve = AncestorType::rowCountHint();
+        if (AncestorType::m_objectReader != nullptr)
+            AncestorType::m_objectReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated DBReader2Object instance. In recycle mode releases the spare elements, which
+        weren't overwritten with read data.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
     */
-    DBReader2STLContainerPtr(Container* container, typename DBReader2Container<Dataset, Object, Container>::Reader2ObjectType* reader):
-        DBReader2Container<Dataset, Object, Container>(container, reader){};
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        m_recycleContainer = nullptr;
+        releaseSpare();
+    };
+    /*!
+        The DBReader2STLContainerPtr implementation of read method creates Object instance with the factory, reads data to it
+        using assosiated DBReader2Object instance and adds it to the container. In recycle mode data is read to the Object
+        instance pointed by the spare element, if there is one.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        if (m_recycle)
+            return readRecycled(ds);
+        return readElement(ds);
+    };
 };
 
 }
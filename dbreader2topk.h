@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBREADER2TOPK_H
+#define DBREADER2TOPK_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include "dbreader2containerbase.h"
+
+namespace dbframework {
+
+/*!
+    The DBReader2TopK template class is the DBReader2ContainerBase descendant that keeps in the container only K best Object
+    instances of the SQL query execution result according to the comparator, for example K largest transactions. The
+    container is kept as the binary heap with the worst of kept objects at the front, so every record is processed in
+    O(log K) time and only K objects are stored. Every record is read to the candidate object owned by DBReader2TopK. If
+    the candidate is better than the worst kept object, they are swapped, so the evicted object is reused to read the next
+    record and no memory is allocated or freed after the container is filled.
+
+    DBReader2TopK can be used as the nested reader of the master object reader, so that every master object gets its own
+    K best detail objects: the master object reader must call setContainer with the container of the master object before
+    calling read. The state of the heap is kept in the container itself.
+
+    After reading the container isn't sorted. Call sort to sort it from the best to the worst object.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2ContainerBase. Must have default constructor and be swappable.
+
+    Container is the class implementing the container of Object with random access iterators, for example std::vector.
+    Container must have push_back, back, begin, end and size methods. The container must be modified only by DBReader2TopK
+    until it is sorted.
+
+    Compare is the comparator class. Compare instance is called as bool compare(const Object& a, const Object& b) and must
+    return true if a is better than b, for example a.amount > b.amount to keep K largest objects.
+*/
+template <class Dataset, class Object, class Container, class Compare>
+class DBReader2TopK : public DBReader2ContainerBase<Dataset, Object, Container> {
+private:
+    typedef DBReader2ContainerBase<Dataset, Object, Container> AncestorType;
+    size_t m_k;
+    Compare m_compare;
+    Object m_candidate;
+public:
+    /*!
+        Constructs DBReader2TopK without assosiated container and DBReader2Object instance.
+        @param[in] k The maximum number of objects kept in the container.
+        @param[in] compare Comparator.
+    */
+    DBReader2TopK(size_t k = 1, const Compare& compare = Compare()) : AncestorType(), m_k(k), m_compare(compare) {};
+    /*!
+        Constructs DBReader2TopK with assosiated container and DBReader2Object instance.
+        @param[in] container Pointer to the container that is used to store read data. The DBReader2TopK doesn't take
+        ownership of container.
+        @param[in] reader Pointer to the DBReader2Object instance used to read Object data. DBReader2TopK doesn't take ownership
+        of reader.
+        @param[in] k The maximum number of objects kept in the container.
+        @param[in] compare Comparator.
+    */
+    DBReader2TopK(Container* container, typename AncestorType::Reader2ObjectType* reader, size_t k, const Compare& compare = Compare()) :
+        AncestorType(container, reader), m_k(k), m_compare(compare) {};
+    /*!
+        Get the maximum number of objects kept in the container.
+        @return The maximum number of objects.
+    */
+    size_t k() const {return m_k;};
+    /*!
+        Set the maximum number of objects kept in the container. Must not be changed while reading to the container.
+        @param[in] k The maximum number of objects.
+    */
+    void setK(size_t k) {m_k = k;};
+    /*!
+        Sets the expected number of records. No more than K objects are reserved in the container.
+        @param[in] count The expected number of records or zero if it is unknown.
+    */
+    void setRowCountHint(size_t count) {AncestorType::setRowCountHint(std::min(count, m_k));};
+    /*!
+        Reads the record to the candidate object and puts it to the container if the container has less than K objects or
+        if the candidate is better than the worst object in the container.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        AncestorType::m_objectReader->setObject(&m_candidate);
+        if (!AncestorType::m_objectReader->read(ds))
+            return false;
+
+        Container& c = *AncestorType::m_container;
+        if (c.size() < m_k) {
+            c.push_back(std::move(m_candidate));
+            m_candidate = Object();
+            std::push_heap(c.begin(), c.end(), m_compare);
+        }
+        else if ((m_k > 0) && m_compare(m_candidate, *c.begin())) {
+            std::pop_heap(c.begin(), c.end(), m_compare);
+            using std::swap;
+            swap(c.back(), m_candidate);
+            std::push_heap(c.begin(), c.end(), m_compare);
+        }
+        return true;
+    };
+    /*!
+        Sorts the assosiated container from the best to the worst object. After sorting the container can't be used for reading.
+    */
+    void sort()
+    {
+        if (AncestorType::m_container != nullptr)
+            std::sort_heap(AncestorType::m_container->begin(), AncestorType::m_container->end(), m_compare);
+    };
+};
+
+}
+
+#endif // DBREADER2TOPK_H
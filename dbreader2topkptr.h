@@ -0,0 +1,165 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBREADER2TOPKPTR_H
+#define DBREADER2TOPKPTR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include "dbreader2containerbase.h"
+#include "dbobjectfactory.h"
+
+namespace dbframework {
+
+/*!
+    The DBReader2TopKPtr template class is the same as DBReader2TopK, but it operates with the container of smart pointers
+    to Object. The evicted object is reused by swapping pointers, so Object isn't required to be swappable. Objects are
+    created with the factory only until the container is filled.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2ContainerBase.
+
+    Container is the class implementing the container of ObjectPtr, see DBReader2TopK.
+
+    ObjectPtr - see DBReader2STLContainerPtr. If ObjectPtr is simple pointer Object*, then the candidate object is deallocated
+    by DBReader2TopKPtr destructor, and care must be taken to deallocate container elements.
+
+    Compare is the comparator class, see DBReader2TopK. It compares Object instances, not pointers.
+
+    Factory is the class used to create Object instances, see DBNewObjectFactory.
+*/
+template <class Dataset, class Object, class Container, class ObjectPtr, class Compare,
+    class Factory = DBNewObjectFactory<Object, ObjectPtr> >
+class DBReader2TopKPtr : public DBReader2ContainerBase<Dataset, Object, Container> {
+private:
+    typedef DBReader2ContainerBase<Dataset, Object, Container> AncestorType;
+
+    class PtrCompare {
+    private:
+        Compare* m_compare;
+    public:
+        PtrCompare(Compare* compare) : m_compare(compare) {};
+        bool operator()(const ObjectPtr& a, const ObjectPtr& b) const {return (*m_compare)(*a, *b);};
+    };
+
+    size_t m_k;
+    Compare m_compare;
+    Factory m_factory;
+    ObjectPtr m_candidate;
+
+    DBReader2TopKPtr(const DBReader2TopKPtr&) = delete;
+    DBReader2TopKPtr& operator=(const DBReader2TopKPtr&) = delete;
+public:
+    /*!
+        Constructs DBReader2TopKPtr without assosiated container and DBReader2Object instance.
+        @param[in] k The maximum number of objects kept in the container.
+        @param[in] compare Comparator.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBReader2TopKPtr(size_t k = 1, const Compare& compare = Compare(), const Factory& factory = Factory()) :
+        AncestorType(), m_k(k), m_compare(compare), m_factory(factory), m_candidate() {};
+    /*!
+        Constructs DBReader2TopKPtr with assosiated container and DBReader2Object instance.
+        @param[in] container Pointer to the container that is used to store read data. The DBReader2TopKPtr doesn't take
+        ownership of container.
+        @param[in] reader Pointer to the DBReader2Object instance used to read Object data. DBReader2TopKPtr doesn't take ownership
+        of reader.
+        @param[in] k The maximum number of objects kept in the container.
+        @param[in] compare Comparator.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBReader2TopKPtr(Container* container, typename AncestorType::Reader2ObjectType* reader, size_t k,
+        const Compare& compare = Compare(), const Factory& factory = Factory()) :
+        AncestorType(container, reader), m_k(k), m_compare(compare), m_factory(factory), m_candidate() {};
+    /*!
+        Destroys DBReader2TopKPtr and releases the candidate object.
+    */
+    ~DBReader2TopKPtr()
+    {
+        if (m_candidate != nullptr)
+            m_factory.destroy(m_candidate);
+    };
+    /*!
+        Get factory used to create Object instances.
+        @return Reference to the factory.
+    */
+    Factory& factory() {return m_factory;};
+    /*!
+        Get the maximum number of objects kept in the container.
+        @return The maximum number of objects.
+    */
+    size_t k() const {return m_k;};
+    /*!
+        Set the maximum number of objects kept in the container. Must not be changed while reading to the container.
+        @param[in] k The maximum number of objects.
+    */
+    void setK(size_t k) {m_k = k;};
+    /*!
+        Sets the expected number of records. No more than K objects are reserved in the container.
+        @param[in] count The expected number of records or zero if it is unknown.
+    */
+    void setRowCountHint(size_t count) {AncestorType::setRowCountHint(std::min(count, m_k));};
+    /*!
+        Reads the record to the candidate object and puts it to the container if the container has less than K objects or
+        if the candidate is better than the worst object in the container.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        if (m_candidate == nullptr)
+            m_candidate = m_factory.create();
+        AncestorType::m_objectReader->setObject(&(*m_candidate));
+        if (!AncestorType::m_objectReader->read(ds))
+            return false;
+
+        Container& c = *AncestorType::m_container;
+        PtrCompare compare(&m_compare);
+        if (c.size() < m_k) {
+            c.push_back(std::move(m_candidate));
+            m_candidate = ObjectPtr();
+            std::push_heap(c.begin(), c.end(), compare);
+        }
+        else if ((m_k > 0) && compare(m_candidate, *c.begin())) {
+            std::pop_heap(c.begin(), c.end(), compare);
+            std::swap(c.back(), m_candidate);
+            std::push_heap(c.begin(), c.end(), compare);
+        }
+        return true;
+    };
+    /*!
+        Sorts the assosiated container from the best to the worst object. After sorting the container can't be used for reading.
+    */
+    void sort()
+    {
+        if (AncestorType::m_container != nullptr)
+            std::sort_heap(AncestorType::m_container->begin(), AncestorType::m_container->end(), PtrCompare(&m_compare));
+    };
+};
+
+}
+
+#endif // DBREADER2TOPKPTR_H
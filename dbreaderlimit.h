@@ -0,0 +1,145 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBREADERLIMIT_H
+#define DBREADERLIMIT_H
+
+#include <cstddef>
+#include "dbreader.h"
+
+namespace dbframework {
+
+/*!
+    The DBReaderLimit template class is the DBReader descendant that passes no more than limit records to the nested reader
+    and then stops reading with DBReadStatus::Stop, so DBSQLExecutor::exec doesn't fetch the rest of the SQL query execution
+    result. It is useful for top-N queries and for existence checks (limit 1). If the nested reader stops reading itself,
+    DBReaderLimit stops too.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+*/
+template <class Dataset>
+class DBReaderLimit : public DBReader<Dataset> {
+private:
+    DBReader<Dataset>* m_reader;
+    size_t m_limit;
+    size_t m_count;
+public:
+    /*!
+        Constructs DBReaderLimit.
+        @param[in] reader Pointer to the nested reader or nullptr if records must be only counted. DBReaderLimit doesn't take
+        ownership of reader.
+        @param[in] limit The maximum number of records to read. If zero, reading stops on the first record without reading it.
+    */
+    DBReaderLimit(DBReader<Dataset>* reader, size_t limit) : DBReader<Dataset>(), m_reader(reader), m_limit(limit), m_count(0) {};
+    /*!
+        Get the nested reader.
+        @return Pointer to the nested reader.
+    */
+    DBReader<Dataset>* reader() {return m_reader;};
+    /*!
+        Set the nested reader.
+        @param[in] reader Pointer to the nested reader. DBReaderLimit doesn't take ownership of reader.
+    */
+    void setReader(DBReader<Dataset>* reader) {m_reader = reader;};
+    /*!
+        Get the maximum number of records to read.
+        @return The maximum number of records.
+    */
+    size_t limit() const {return m_limit;};
+    /*!
+        Set the maximum number of records to read.
+        @param[in] limit The maximum number of records.
+    */
+    void setLimit(size_t limit) {m_limit = limit;};
+    /*!
+        Get the number of records read since the last SQL query execution result.
+        @return The number of records read.
+    */
+    size_t count() const {return m_count;};
+    /*!
+        Resets the counter of records and passes the call to the nested reader.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        m_count = 0;
+        if (m_reader != nullptr)
+            m_reader->begin(ds);
+    };
+    /*!
+        Passes the call to the nested reader.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        if (m_reader != nullptr)
+            m_reader->end(ds, ok);
+    };
+    /*!
+        Passes the hint to the nested reader. The hint is limited by limit.
+        @param[in] count The expected number of records or zero if it is unknown.
+    */
+    void setRowCountHint(size_t count)
+    {
+        if (m_reader != nullptr)
+            m_reader->setRowCountHint((count < m_limit) ? count : m_limit);
+    };
+    /*!
+        Passes the call to the nested reader.
+        @param[in] rows The number of records read.
+        @return The size of the result reported by the nested reader.
+    */
+    size_t resultSize(size_t rows) const
+    {
+        return (m_reader != nullptr) ? m_reader->resultSize(rows) : rows;
+    };
+    /*!
+        Reads the record with the nested reader if the limit isn't reached.
+        @param[in] ds Dataset to read from.
+        @return DBReadStatus::Failed if the nested reader failed, DBReadStatus::Stop if the limit is reached or the nested
+        reader stopped reading, DBReadStatus::Continue otherwise.
+    */
+    DBReadStatus readRow(Dataset& ds)
+    {
+        if (m_count >= m_limit)
+            return DBReadStatus::Stop;
+
+        DBReadStatus status = (m_reader != nullptr) ? m_reader->readRow(ds) : DBReadStatus::Continue;
+        if (status == DBReadStatus::Failed)
+            return status;
+        ++m_count;
+        return (m_count >= m_limit) ? DBReadStatus::Stop : status;
+    };
+    /*!
+        Reads the record like readRow.
+        @param[in] ds Dataset to read from.
+        @return False if the nested reader failed.
+    */
+    bool read(Dataset& ds)
+    {
+        return readRow(ds) != DBReadStatus::Failed;
+    };
+};
+
+}
+
+#endif // DBREADERLIMIT_H
@@ -63,6 +63,45 @@ public:
     {
         return m_op(m_first->read(ds), m_second->read(ds));
     };
+    /*!
+        Passes the hint to both DBReader instances.
+        @param[in] count The expected number of records or zero if it is unknown.
+    */
+    void setRowCountHint(size_t count)
+    {
+        m_first->setRowCountHint(count);
+        m_second->setRowCountHint(count);
+    };
+    /*!
+        Passes the call to both DBReader instances.
+        @param[in] rows The number of records read.
+        @return The greater of the sizes of the result reported by both DBReader instances.
+    */
+    size_t resultSize(size_t rows) const
+    {
+        size_t first = m_first->resultSize(rows);
+        size_t second = m_second->resultSize(rows);
+        return (first > second) ? first : second;
+    };
+    /*!
+        Passes the call to both DBReader instances.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        m_first->begin(ds);
+        m_second->begin(ds);
+    };
+    /*!
+        Passes the call to both DBReader instances.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        m_first->end(ds, ok);
+        m_second->end(ds, ok);
+    };
 };
 
 }
@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBRESERVE_H
+#define DBRESERVE_H
+
+#include <cstddef>
+
+namespace dbframework {
+
+template <class Container>
+auto reserveContainer(Container& container, size_t count, int) -> decltype(container.reserve(count), void())
+{
+    container.reserve(count);
+}
+
+template <class Container>
+void reserveContainer(Container&, size_t, long)
+{
+}
+
+/*!
+    Reserves space for count elements in the container if the container has reserve method (like std::vector and
+    std::unordered_map). For other containers (like std::map and std::list) does nothing.
+    @param[in] container Container.
+    @param[in] count The number of elements.
+*/
+template <class Container>
+void reserveContainer(Container& container, size_t count)
+{
+    reserveContainer(container, count, 0);
+}
+
+template <class Container>
+auto containerSize(const Container& container, size_t, int) -> decltype(static_cast<size_t>(container.size()))
+{
+    return static_cast<size_t>(container.size());
+}
+
+template <class Container>
+size_t containerSize(const Container&, size_t fallback, long)
+{
+    return fallback;
+}
+
+/*!
+    Get the number of elements in the container if the container has size method.
+    @param[in] container Container.
+    @param[in] fallback Value returned if the container doesn't have size method.
+    @return The number of elements or fallback.
+*/
+template <class Container>
+size_t containerSize(const Container& container, size_t fallback)
+{
+    return containerSize(container, fallback, 0);
+}
+
+template <class Container>
+auto reserveAdditional(Container& container, size_t count, int) -> decltype(container.reserve(container.size() + count), void())
+{
+    container.reserve(container.size() + count);
+}
+
+template <class Container>
+void reserveAdditional(Container&, size_t, long)
+{
+}
+
+/*!
+    Reserves space for count elements in addition to the elements already stored in the container if the container has
+    reserve and size methods. For other containers does nothing.
+    @param[in] container Container.
+    @param[in] count The number of elements to add.
+*/
+template <class Container>
+void reserveAdditional(Container& container, size_t count)
+{
+    reserveAdditional(container, count, 0);
+}
+
+}
+
+#endif // DBRESERVE_H
@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBROWCOUNTHISTORY_H
+#define DBROWCOUNTHISTORY_H
+
+#include <cstddef>
+#include <vector>
+
+namespace dbframework {
+
+/*!
+    The DBRowCountHistory class keeps the sizes of the results of the last executions of one SQL query and provides
+    their maximum as the row count hint for the next execution (see DBReader::setRowCountHint). DBSQLExecutor::exec
+    records the size reported by DBReader::resultSize: the number of records, or the number of objects for readers with
+    Key, which store several records in one object. Keep one DBRowCountHistory
+    instance for every statement, for example next to the prepared Dataset, and pass it to DBSQLExecutor::exec. Queries
+    that return nearly the same number of records every time (like periodic refresh queries) read their results into
+    containers reserved in advance, without reallocations and rehashes.
+
+    DBRowCountHistory isn't thread safe.
+*/
+class DBRowCountHistory {
+private:
+    std::vector<size_t> m_counts;
+    size_t m_next;
+    size_t m_size;
+public:
+    /*!
+        Constructs empty DBRowCountHistory.
+        @param[in] window The number of last executions used to calculate the hint. Zero is treated as one.
+    */
+    DBRowCountHistory(size_t window = 8) : m_counts((window > 0) ? window : 1, 0), m_next(0), m_size(0) {};
+    /*!
+        Adds the size of the result of the SQL query execution. Only successful executions should be added.
+        @param[in] count The number of records or objects, see DBReader::resultSize.
+    */
+    void add(size_t count)
+    {
+        m_counts[m_next] = count;
+        m_next = (m_next + 1) % m_counts.size();
+        if (m_size < m_counts.size())
+            ++m_size;
+    };
+    /*!
+        Get the row count hint.
+        @return The maximum size of the results of the last executions or zero if there is no history.
+    */
+    size_t hint() const
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < m_size; ++i) {
+            if (m_counts[i] > result)
+                result = m_counts[i];
+        }
+        return result;
+    };
+    /*!
+        Get the number of executions in the history.
+        @return The number of executions, no more than the window size.
+    */
+    size_t size() const {return m_size;};
+    /*!
+        Removes all executions from the history.
+    */
+    void clear()
+    {
+        m_next = 0;
+        m_size = 0;
+    };
+};
+
+}
+
+#endif // DBROWCOUNTHISTORY_H
@@ -20,11 +20,58 @@ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
 #include "dbbinder.h"
+#include "dbbindobject.h"
+#include "dbqueryrange.h"
 #include "dbreader.h"
+#include "dbrowcounthistory.h"
+#include "dbsqlexecobserver.h"
 
 namespace dbframework {
 
+/*!
+    The DBBatchResult class contains the statistics of SQL query execution with DBSQLExecutor::execBatch.
+*/
+class DBBatchResult {
+public:
+    /*!
+        The number of successfully executed rows.
+    */
+    size_t rows;
+    /*!
+        The number of rows whose transactions were committed.
+    */
+    size_t committed;
+    /*!
+        True if execution stopped because of failure.
+    */
+    bool failed;
+    /*!
+        Zero-based index of the element that caused failure. Valid if failed is true.
+    */
+    size_t failedIndex;
+    /*!
+        Execution time in seconds.
+    */
+    double seconds;
+    /*!
+        Constructs DBBatchResult with zero values.
+    */
+    DBBatchResult() : rows(0), committed(0), failed(false), failedIndex(0), seconds(0) {};
+    /*!
+        Get execution speed.
+        @return The number of successfully executed rows per second.
+    */
+    double rowsPerSecond() const
+    {
+        return (seconds > 0) ? rows / seconds : 0;
+    };
+};
+
 /*!
     The DBSQLExecutor class template implements the algorithm of retrieving SQL query exectution result
     using DBBinder for parameter binding and DBReader for reading data. Inherit from this class to implement
@@ -38,6 +85,7 @@ namespace dbframework {
 */
 template<class Dataset>
 class DBSQLExecutor {
+    template <class D, class O> friend class DBQueryRange;
 protected:
     /*!
         This method must execute the query using provided Dataset object.
@@ -52,7 +100,240 @@ protected:
         @param[in] ds Dataset object to use for iteration.
     */
     virtual bool next(Dataset& ds) = 0;
+    /*!
+        This method is called after next returned false. Override it if next can fail to fetch the record (for example,
+        because the database is busy or corrupted), so that the result truncated by the error isn't taken for the end of
+        the result: the reader's end is called with false and exec returns false. Default implementation returns false.
+        @param[in] ds Dataset object used for query execution.
+        @return True if next returned false because fetching the record failed.
+    */
+    virtual bool fetchFailed(Dataset& /*ds*/) {return false;};
+    /*!
+        This method is called when reading stops before the end of SQL query execution result, because reader's readRow
+        returned DBReadStatus::Stop or DBReadStatus::Failed or fetching the record failed, after reader's end is called.
+        Override it to release the resources held by the active Dataset, for example to reset the statement so that its
+        read transaction and locks are released. Default implementation does nothing.
+        @param[in] ds Dataset object used for query execution.
+    */
+    virtual void finishQuery(Dataset& /*ds*/) {};
+    /*!
+        This method is used by execBatch to start transaction. Default implementation does nothing and returns true.
+        Override it together with commitTransaction and rollbackTransaction to let execBatch commit every K rows.
+        @param[in] ds Dataset object used for query execution.
+        @return True if success.
+    */
+    virtual bool beginTransaction(Dataset& /*ds*/) {return true;};
+    /*!
+        This method is used by execBatch to commit transaction started with beginTransaction. Default implementation
+        does nothing and returns true.
+        @param[in] ds Dataset object used for query execution.
+        @return True if success.
+    */
+    virtual bool commitTransaction(Dataset& /*ds*/) {return true;};
+    /*!
+        This method is used by execBatch to roll back transaction started with beginTransaction. Default implementation
+        does nothing and returns true.
+        @param[in] ds Dataset object used for query execution.
+        @return True if success.
+    */
+    virtual bool rollbackTransaction(Dataset& /*ds*/) {return true;};
+    /*!
+        This method is used by execBatch with the multi-row query to select the row which parameters are bound by the
+        binder, so that the binder binding one row can bind every row of the query (for example, by adding the offset to
+        the parameter index). Default implementation returns false, so execBatch with the multi-row query fails.
+        @param[in] ds Dataset object used for query execution.
+        @param[in] row Zero-based row number.
+        @param[in] rowCount The number of rows in the query.
+        @return True if success.
+    */
+    virtual bool selectBatchRow(Dataset& /*ds*/, size_t /*row*/, size_t /*rowCount*/) {return false;};
+private:
+    DBSQLExecObserver<Dataset>* m_observer;
+
+    static std::atomic<DBSQLExecObserver<Dataset>*>& globalObserverRef()
+    {
+        static std::atomic<DBSQLExecObserver<Dataset>*> observer(nullptr);
+        return observer;
+    };
+    /*!
+        Measures execution phases for the observer. If it is disabled, the clock isn't sampled.
+    */
+    class PhaseTimer {
+    private:
+        typedef std::chrono::steady_clock Clock;
+        bool m_enabled;
+        Clock::time_point m_start;
+        Clock::time_point m_last;
+    public:
+        PhaseTimer(bool enabled) : m_enabled(enabled)
+        {
+            if (m_enabled)
+                m_start = m_last = Clock::now();
+        };
+        void lap(double& seconds)
+        {
+            if (m_enabled) {
+                Clock::time_point now = Clock::now();
+                seconds += std::chrono::duration<double>(now - m_last).count();
+                m_last = now;
+            }
+        };
+        double total() const {return std::chrono::duration<double>(m_last - m_start).count();};
+    };
+    template <class Binder, class Reader>
+    bool execute(Dataset& ds, Binder* binder, Reader* reader, size_t* rows = nullptr)
+    {
+        DBSQLExecObserver<Dataset>* observer = m_observer;
+        DBSQLExecObserver<Dataset>* global = globalObserverRef().load(std::memory_order_acquire);
+        if (global == observer)
+            global = nullptr;
+        PhaseTimer timer((observer != nullptr) || (global != nullptr));
+        DBSQLExecInfo info;
+
+        if (binder != nullptr) {
+            binder->bind(ds);
+            timer.lap(info.bindSeconds);
+        }
+
+        info.executed = executeQuery(ds);
+        bool result = info.executed;
+        timer.lap(info.executeSeconds);
+
+        if (result && (reader != nullptr)) {
+            reader->begin(ds);
+            timer.lap(info.readSeconds);
+            DBReadStatus status = DBReadStatus::Continue;
+            while (status == DBReadStatus::Continue) {
+                bool hasNext = next(ds);
+                timer.lap(info.nextSeconds);
+                if (!hasNext) {
+                    info.fetchFailed = fetchFailed(ds);
+                    break;
+                }
+                status = readRecord(*reader, ds);
+                ++info.rows;
+                timer.lap(info.readSeconds);
+            }
+            info.readFailed = (status == DBReadStatus::Failed);
+            info.stopped = (status == DBReadStatus::Stop);
+            result = !info.readFailed && !info.fetchFailed;
+            reader->end(ds, result);
+            if ((status != DBReadStatus::Continue) || info.fetchFailed)
+                finishQuery(ds);
+            timer.lap(info.readSeconds);
+        }
+
+        if ((observer != nullptr) || (global != nullptr)) {
+            info.totalSeconds = timer.total();
+            info.result = result;
+            if (observer != nullptr)
+                observer->finished(ds, info);
+            if (global != nullptr)
+                global->finished(ds, info);
+        }
+        if (rows != nullptr)
+            *rows = info.rows;
+        return result;
+    };
+    template <class Iterator, class Bind>
+    bool runBatch(Dataset& ds, Dataset& tailDs, size_t rowsPerQuery, Iterator first, Iterator last, size_t commitSize,
+        DBBatchResult* result, Bind bind)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        DBBatchResult r;
+        bool ok = true;
+        bool inTransaction = false;
+        size_t index = 0;
+        size_t remaining = (rowsPerQuery > 1) ? static_cast<size_t>(std::distance(first, last)) : 0;
+
+        for (Iterator i = first; ok && (i != last);) {
+            if ((commitSize > 0) && !inTransaction) {
+                ok = beginTransaction(ds);
+                inTransaction = ok;
+            }
+            bool multiRow = (rowsPerQuery > 1) && (remaining >= rowsPerQuery);
+            size_t count = multiRow ? rowsPerQuery : 1;
+            Dataset& query = multiRow ? ds : tailDs;
+            for (size_t row = 0; ok && (row < count); ++row, ++i) {
+                if (multiRow)
+                    ok = selectBatchRow(query, row, count);
+                if (ok)
+                    bind(query, *i);
+            }
+            if (ok && multiRow)
+                ok = selectBatchRow(query, 0, count);
+            if (ok)
+                ok = executeQuery(query);
+            if (ok) {
+                r.rows += count;
+                if (multiRow)
+                    remaining -= count;
+                if ((commitSize > 0) && (r.rows - r.committed >= commitSize)) {
+                    inTransaction = false;
+                    ok = commitTransaction(ds);
+                    if (ok)
+                        r.committed = r.rows;
+                }
+            }
+            if (!ok) {
+                r.failed = true;
+                r.failedIndex = index;
+            }
+            index += count;
+        }
+
+        if (ok && inTransaction) {
+            inTransaction = false;
+            ok = commitTransaction(ds);
+            if (ok) {
+                r.committed = r.rows;
+            }
+            else {
+                r.failed = true;
+                r.failedIndex = index - 1;
+            }
+        }
+        if (inTransaction) {
+            rollbackTransaction(ds);
+        }
+        if (commitSize == 0) {
+            r.committed = r.rows;
+        }
+
+        r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (result != nullptr) {
+            *result = r;
+        }
+        return ok;
+    };
 public:
+    /*!
+        Constructs DBSQLExecutor without observer.
+    */
+    DBSQLExecutor() : m_observer(nullptr) {};
+    /*!
+        Get the observer installed for this instance.
+        @return Pointer to the observer or nullptr if it isn't installed.
+    */
+    DBSQLExecObserver<Dataset>* observer() const {return m_observer;};
+    /*!
+        Install the observer that receives phase timings of exec and execStatic calls of this instance. The observer of
+        the instance is called before the global observer, so both of them receive every call.
+        @param[in] observer Pointer to the observer or nullptr to remove it. DBSQLExecutor doesn't take ownership of observer.
+    */
+    void setObserver(DBSQLExecObserver<Dataset>* observer) {m_observer = observer;};
+    /*!
+        Get the global observer for the Dataset.
+        @return Pointer to the global observer or nullptr if it isn't installed.
+    */
+    static DBSQLExecObserver<Dataset>* globalObserver() {return globalObserverRef().load(std::memory_order_acquire);};
+    /*!
+        Install the observer that receives phase timings of exec and execStatic calls of all DBSQLExecutor instances
+        with the same Dataset, including the instances that have their own observer. The observer may be called from many
+        threads.
+        @param[in] observer Pointer to the observer or nullptr to remove it. DBSQLExecutor doesn't take ownership of observer.
+    */
+    static void setGlobalObserver(DBSQLExecObserver<Dataset>* observer) {globalObserverRef().store(observer, std::memory_order_release);};
     /*!
         This method binds SQL query parmeters, executes the query and reads the results.
         @param[in] ds Dataset object to use for query execution. It must have SQL query text set and be prepared for parameter
@@ -61,25 +342,144 @@ public:
         is performed. This is useful for SQL queries without parameters. DBSQLExecutor doesn't take ownership of binder.
         @param[in] reader Pointer to DBReader descendant that must be used for reading SQL query execution results. If nullptr, reading is
         not performed. This is useful for queries without result, for example for DML queries. DBSQLExecutor doesn't take ownership of reader.
+        After successful query execution reader's begin is called once before reading the first record. Every record
+        is read with reader's readRow. If it returns DBReadStatus::Stop, the rest of records isn't fetched and exec succeeds.
+        After reading reader's end is called once with the result of reading. If reading stopped before the end of the result,
+        finishQuery is called then.
+        If observer is installed (see setObserver and setGlobalObserver), it receives the timings of execution phases.
     */
     bool exec(Dataset& ds, DBBinder<Dataset> *binder, DBReader<Dataset> *reader)
     {
-        bool result = true;               
-
-        if (binder != nullptr) {
-            binder->bind(ds);
-        }
-
-        result = executeQuery(ds);
-        
-        if (result && (reader != nullptr)) {
-            for (;next(ds) && result;) {
-                result = reader->read(ds);
-            }
-        }
-       
+        return execute(ds, binder, reader);
+    }
+    /*!
+        This method is the same as exec, but it passes the row count hint from the history of previous executions of the
+        SQL query to the reader (see DBReader::setRowCountHint) and adds the size of the result to the history if execution
+        succeeds. The size of the result is reported by reader's resultSize, so for readers with Key (see
+        DBReader2ContainerWithKey) the history records the number of objects rather than the number of records.
+        @param[in] ds Dataset object to use for query execution.
+        @param[in] binder Pointer to DBBinder descendant or nullptr, see exec.
+        @param[in] reader Pointer to DBReader descendant or nullptr, see exec.
+        @param[in] history Row count history of the SQL query. DBSQLExecutor doesn't take ownership of history.
+    */
+    bool exec(Dataset& ds, DBBinder<Dataset> *binder, DBReader<Dataset> *reader, DBRowCountHistory* history)
+    {
+        if ((reader != nullptr) && (history != nullptr))
+            reader->setRowCountHint(history->hint());
+        size_t rows = 0;
+        bool result = execute(ds, binder, reader, &rows);
+        if (result && (reader != nullptr) && (history != nullptr))
+            history->add(reader->resultSize(rows));
         return result;
     }
+    /*!
+        This method is the same as exec, but it uses static binder and static reader (see DBStaticBindObject and DBStaticReader).
+        Calls of binder and reader methods are resolved at compile time, so no virtual calls are made while reading records
+        unless nested readers are virtual.
+        @param[in] ds Dataset object to use for query execution. It must have SQL query text set and be prepared for parameter
+        binding and query execution.
+        @param[in] binder Pointer to the static binder or typed nullptr (for example, static_cast<DBStaticBinders<Dataset>*>(nullptr)).
+        DBSQLExecutor doesn't take ownership of binder.
+        @param[in] reader Pointer to the static reader or typed nullptr. DBSQLExecutor doesn't take ownership of reader.
+    */
+    template <class Binder, class Reader>
+    bool execStatic(Dataset& ds, Binder* binder, Reader* reader)
+    {
+        return execute(ds, binder, reader);
+    }
+    /*!
+        This method binds SQL query parameters and returns DBQueryRange that executes the query and reads records one by one
+        as it is iterated, for example:
+        \code
+        for (const Customer& c : executor.query(ds, &binder, &reader))
+            ...
+        \endcode
+        @param[in] ds Dataset object to use for query execution. It must have SQL query text set and be prepared for parameter
+        binding and query execution.
+        @param[in] binder Pointer to DBBinder descendant that must be used for parameter binding or nullptr. DBSQLExecutor doesn't
+        take ownership of binder.
+        @param[in] reader Pointer to DBReader2Object descendant that must be used for reading records. DBSQLExecutor doesn't take
+        ownership of reader.
+        @return DBQueryRange over the SQL query execution result.
+    */
+    template <class Object>
+    DBQueryRange<Dataset, Object> query(Dataset& ds, DBBinder<Dataset>* binder, DBReader2Object<Dataset, Object>* reader)
+    {
+        return DBQueryRange<Dataset, Object>(this, &ds, binder, reader);
+    };
+    /*!
+        This method executes the same query for every binder in the range [first, last). Parameters are bound with the binder,
+        the query is executed and reading isn't performed. Execution stops on the first failure.
+        If commitSize is greater than zero, then rows are executed in transactions of commitSize rows, started and committed
+        with beginTransaction and commitTransaction. Transaction of the failed row is rolled back with rollbackTransaction.
+        @param[in] ds Dataset object to use for query execution. It must have SQL query text set and be prepared for parameter
+        binding and query execution.
+        @param[in] first Iterator pointing to the first element of the range. Range elements must be pointers to DBBinder.
+        DBSQLExecutor doesn't take ownership of binders.
+        @param[in] last Iterator pointing past the last element of the range.
+        @param[in] commitSize The number of rows in one transaction or zero if transactions are controlled by the caller.
+        @param[out] result Pointer to DBBatchResult that receives execution statistics. Can be nullptr.
+        @return True if all rows were successfully executed and committed.
+    */
+    template <class Iterator>
+    bool execBatch(Dataset& ds, Iterator first, Iterator last, size_t commitSize = 0, DBBatchResult* result = nullptr)
+    {
+        return runBatch(ds, ds, 1, first, last, commitSize, result, [](Dataset& query, DBBinder<Dataset>* binder) {binder->bind(query);});
+    };
+    /*!
+        This method executes the same query for every object in the range [first, last). Parameters are bound with binder
+        assosiated with the object, the query is executed and reading isn't performed. Execution stops on the first failure.
+        Transactions are controlled like in execBatch(ds, first, last, commitSize, result).
+        @param[in] ds Dataset object to use for query execution. It must have SQL query text set and be prepared for parameter
+        binding and query execution.
+        @param[in] binder Pointer to DBBindObject descendant that is used for parameter binding. Binder is assosiated with every
+        object in the range by calling its setObject method. DBSQLExecutor doesn't take ownership of binder.
+        @param[in] first Iterator pointing to the first object of the range.
+        @param[in] last Iterator pointing past the last object of the range.
+        @param[in] commitSize The number of rows in one transaction or zero if transactions are controlled by the caller.
+        @param[out] result Pointer to DBBatchResult that receives execution statistics. Can be nullptr.
+        @return True if all rows were successfully executed and committed.
+    */
+    template <class Object, class Iterator>
+    bool execBatch(Dataset& ds, DBBindObject<Dataset, Object>* binder, Iterator first, Iterator last, size_t commitSize = 0,
+        DBBatchResult* result = nullptr)
+    {
+        return runBatch(ds, ds, 1, first, last, commitSize, result, [binder](Dataset& query, Object& obj) {
+            binder->setObject(&obj);
+            binder->bind(query);
+        });
+    };
+    /*!
+        This method inserts the objects from the range [first, last) with the multi-row query, for example generated by
+        DBSQLGeneratorImpl::insert(d, withKeyFields, rowCount), so that the number of executed queries is divided by
+        rowsPerQuery. The objects are split into chunks of rowsPerQuery objects, every object of the chunk is bound with
+        binder to its row of the query selected with selectBatchRow, and the query is executed with ds. The objects left
+        after the last full chunk are executed one by one with the single-row query tailDs. Execution stops on the first
+        failure. Transactions are controlled like in execBatch(ds, first, last, commitSize, result), but the transaction
+        is committed after the query that makes the number of rows in it reach commitSize.
+        @param[in] ds Dataset object prepared with the query inserting rowsPerQuery rows. Use
+        DBSQLGeneratorImpl::insertRowCount to choose rowsPerQuery that doesn't exceed DBMS limit of the number of parameters.
+        @param[in] tailDs Dataset object prepared with the query inserting one row. It must use the same connection as ds.
+        @param[in] rowsPerQuery The number of rows inserted by the query of ds. If it is less than 2, all objects are executed
+        with tailDs.
+        @param[in] binder Pointer to DBBindObject descendant that binds one row. Binder is assosiated with every object in the
+        range by calling its setObject method. DBSQLExecutor doesn't take ownership of binder.
+        @param[in] first Iterator pointing to the first object of the range.
+        @param[in] last Iterator pointing past the last object of the range.
+        @param[in] commitSize The number of rows in one transaction or zero if transactions are controlled by the caller.
+        @param[out] result Pointer to DBBatchResult that receives execution statistics. If the multi-row query fails,
+        failedIndex is the index of the first object of the chunk. Can be nullptr.
+        @return True if all rows were successfully executed and committed.
+    */
+    template <class Object, class Iterator>
+    bool execBatch(Dataset& ds, Dataset& tailDs, size_t rowsPerQuery, DBBindObject<Dataset, Object>* binder,
+        Iterator first, Iterator last, size_t commitSize = 0, DBBatchResult* result = nullptr)
+    {
+        return runBatch(ds, tailDs, rowsPerQuery, first, last, commitSize, result, [binder](Dataset& query, Object& obj) {
+            binder->setObject(&obj);
+            binder->bind(query);
+        });
+    };
 };
 
 }
@@ -0,0 +1,113 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSQLEXECOBSERVER_H
+#define DBSQLEXECOBSERVER_H
+
+#include <cstddef>
+
+namespace dbframework {
+
+/*!
+    The DBSQLExecInfo class contains the timings of the phases of one call to DBSQLExecutor::exec or DBSQLExecutor::execStatic.
+    The time of reader's begin and end is included in readSeconds.
+*/
+class DBSQLExecInfo {
+public:
+    /*!
+        Time spent in binder's bind method in seconds.
+    */
+    double bindSeconds;
+    /*!
+        Time spent in DBSQLExecutor::executeQuery in seconds.
+    */
+    double executeSeconds;
+    /*!
+        Time spent in DBSQLExecutor::next in seconds.
+    */
+    double nextSeconds;
+    /*!
+        Time spent in reader's methods in seconds.
+    */
+    double readSeconds;
+    /*!
+        Total execution time in seconds.
+    */
+    double totalSeconds;
+    /*!
+        The number of records passed to the reader.
+    */
+    size_t rows;
+    /*!
+        True if executeQuery succeeded.
+    */
+    bool executed;
+    /*!
+        True if the reader failed to read the record.
+    */
+    bool readFailed;
+    /*!
+        True if fetching the record failed, see DBSQLExecutor::fetchFailed.
+    */
+    bool fetchFailed;
+    /*!
+        True if the reader stopped reading with DBReadStatus::Stop.
+    */
+    bool stopped;
+    /*!
+        The value returned by exec.
+    */
+    bool result;
+    /*!
+        Constructs DBSQLExecInfo with zero values.
+    */
+    DBSQLExecInfo() : bindSeconds(0), executeSeconds(0), nextSeconds(0), readSeconds(0), totalSeconds(0), rows(0),
+        executed(false), readFailed(false), fetchFailed(false), stopped(false), result(false) {};
+};
+
+/*!
+    The DBSQLExecObserver template class is the interface of the observer that receives phase timings of SQL query execution
+    from DBSQLExecutor. Observer can be installed for DBSQLExecutor instance with DBSQLExecutor::setObserver or for all
+    DBSQLExecutor instances with the same Dataset with DBSQLExecutor::setGlobalObserver. If both are installed, both of them
+    receive every call, so for example the phase observer of the instance and global DBSQLStatistics can be used together.
+    If no observer is installed, DBSQLExecutor doesn't measure time.
+
+    Template parameters.
+
+    Dataset - see DBSQLExecutor.
+*/
+template <class Dataset>
+class DBSQLExecObserver {
+public:
+    /*!
+        Virtual destructor.
+    */
+    virtual ~DBSQLExecObserver() {};
+    /*!
+        This method must be implemented by the descendants. It is called after every call to DBSQLExecutor::exec and
+        DBSQLExecutor::execStatic. It is called from the thread that executed the query.
+        @param[in] ds Dataset object used for query execution. It identifies the SQL query, for example by its text.
+        @param[in] info Phase timings and the result of execution.
+    */
+    virtual void finished(Dataset& ds, const DBSQLExecInfo& info) = 0;
+};
+
+}
+
+#endif // DBSQLEXECOBSERVER_H
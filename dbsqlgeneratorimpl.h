@@ -61,6 +61,47 @@ private:
         result += d->parameterName(d->commonField(i));
         return result;
     };
+    I insertFieldCount(DBObjectDescriptor<S, I>* d, bool withKeyFields) const
+    {
+        return withKeyFields ? d->keyFieldCount() + d->commonFieldCount() : d->commonFieldCount();
+    };
+    S insertField(DBObjectDescriptor<S, I>* d, bool withKeyFields, I index) const
+    {
+        if (withKeyFields) {
+            if (index < d->keyFieldCount())
+                return d->keyField(index);
+            index -= d->keyFieldCount();
+        }
+        return d->commonField(index);
+    };
+    S insertHead(DBObjectDescriptor<S, I>* d, bool withKeyFields) const
+    {
+        S result("insert into ");
+        result += d->tableName();
+        result += S("(");
+        for (I i = 0; i < insertFieldCount(d, withKeyFields); ++i) {
+            if (i > 0) {
+                result += S(", ");
+            }
+            result += insertField(d, withKeyFields, i);
+        }
+        result += S(") values ");
+        return result;
+    };
+protected:
+    /*!
+        This method is used by insert(d, withKeyFields, rowCount) to get the name of the parameter for the field in the row.
+        Default implementation returns S("?"), so generated query has positional parameters and can be bound by binding
+        the objects one after another. Override this method to generate named parameters distinct for every row.
+        @param[in] d Pointer to DBObjectDescriptor instance that describes the table.
+        @param[in] fieldName Name of the field.
+        @param[in] row Zero-based row number.
+        @return Parameter name.
+    */
+    virtual S rowParameterName(DBObjectDescriptor<S, I>* /*d*/, const S& /*fieldName*/, I /*row*/) const
+    {
+        return S("?");
+    };
 public:    
     /*!
         This method generates query for inserting object's data into a table. For example tables it generates following 
@@ -78,60 +119,79 @@ public:
     */
     S insert(DBObjectDescriptor<S, I>* d, bool withKeyFields) const
     {
-        if (!withKeyFields && (d->commonFieldCount() == 0))
-            return S();
-        if (withKeyFields && (d->commonFieldCount() + d->keyFieldCount() == 0))
+        I count = insertFieldCount(d, withKeyFields);
+        if (count == 0)
             return S();
 
-        S result("insert into ");
-        result += d->tableName();
+        S result = insertHead(d, withKeyFields);
         result += S("(");
-        I i;
-
-        if (withKeyFields) {
-            for (i = 0; i < d->keyFieldCount() - 1; ++i) {
-                result += d->keyField(i);
+        for (I i = 0; i < count; ++i) {
+            if (i > 0) {
                 result += S(", ");
             }
-            if (i < d->keyFieldCount()) {
-                result += d->keyField(i);
-                if (d->commonFieldCount() > 0) {
-                    result += S(", ");
-                }
-            }
-        }
-        for (i = 0; i < d->commonFieldCount() - 1; ++i) {
-            result += d->commonField(i);
-            result += S(", ");
+            result += d->parameterName(insertField(d, withKeyFields, i));
         }
-        if (i < d->commonFieldCount()) {
-            result += d->commonField(i);            
-        }
-        result += S(") values (");
+        result += S(")");
 
-        if (withKeyFields) {
-            for (i = 0; i < d->keyFieldCount() - 1; ++i) {
-                result += d->parameterName(d->keyField(i));
-                result += S(", ");
-            }
-            if (i < d->keyFieldCount()) {
-                result += d->parameterName(d->keyField(i));
-                if (d->commonFieldCount() > 0) {
+        return result;
+    };
+    /*!
+        This method generates query for inserting data of several objects into a table with one statement. Parameter names
+        for every row are generated by rowParameterName, so by default parameters are positional. For example tables it generates
+        following queries.
+        Table1 (withKeyFields == true, rowCount == 2): insert into Table1(id1, id2, value1, value2) values (?, ?, ?, ?), (?, ?, ?, ?)
+        Table1 (withKeyFields == false, rowCount == 2): insert into Table1(value1, value2) values (?, ?), (?, ?)
+        Table2 (withKeyFields == false): returns S()
+        Table3 (rowCount == 3): insert into Table3(value1, value2) values (?, ?), (?, ?), (?, ?)
+        DBMS usually limit the number of parameters in one SQL query. Use insertRowCount to get the maximum rowCount for the limit.
+        Use DBSQLExecutor::execBatch(ds, tailDs, rowsPerQuery, binder, first, last, commitSize, result) to insert the objects
+        in chunks of rowCount rows.
+        @param[in] d Pointer to DBObjectDescriptor instance that describes the table. DBSQLGenerator doesn't take
+        ownership of d.
+        @param[in] withKeyFields If true the method must include primary key fields into the query. Otherwise it mustn't
+        include primary key fields into the query.
+        @param[in] rowCount The number of rows inserted by the query.
+        @return SQL query text, see examples in method description. Returns S() if rowCount is zero.
+    */
+    S insert(DBObjectDescriptor<S, I>* d, bool withKeyFields, I rowCount) const
+    {
+        I count = insertFieldCount(d, withKeyFields);
+        if ((count == 0) || (rowCount == 0))
+            return S();
+
+        S result = insertHead(d, withKeyFields);
+        for (I row = 0; row < rowCount; ++row) {
+            result += (row > 0) ? S(", (") : S("(");
+            for (I i = 0; i < count; ++i) {
+                if (i > 0) {
                     result += S(", ");
                 }
+                result += rowParameterName(d, insertField(d, withKeyFields, i), row);
             }
+            result += S(")");
         }
-        for (i = 0; i < d->commonFieldCount() - 1; ++i) {
-            result += d->parameterName(d->commonField(i));
-            result += S(", ");
-        }
-        if (i < d->commonFieldCount()) {
-            result += d->parameterName(d->commonField(i));
-        }
-        result += S(")");
 
         return result;
     };
+    /*!
+        This method calculates the maximum number of rows that can be inserted by one query generated by
+        insert(d, withKeyFields, rowCount) without exceeding DBMS limit of the number of parameters in one SQL query.
+        To insert N objects execute N / insertRowCount(...) queries with rowCount == insertRowCount(...) and one query
+        with rowCount == N % insertRowCount(...), if the remainder isn't zero.
+        @param[in] d Pointer to DBObjectDescriptor instance that describes the table. DBSQLGenerator doesn't take
+        ownership of d.
+        @param[in] withKeyFields If true primary key fields are included into the query.
+        @param[in] maxParameters The maximum number of parameters in one SQL query supported by DBMS.
+        @return The maximum number of rows in one query or zero if one row requires more than maxParameters parameters or
+        there are no fields to insert.
+    */
+    I insertRowCount(DBObjectDescriptor<S, I>* d, bool withKeyFields, I maxParameters) const
+    {
+        I count = insertFieldCount(d, withKeyFields);
+        if ((count == 0) || (count > maxParameters))
+            return 0;
+        return maxParameters / count;
+    };
     /*!
         This method generates query for updating object's data in a table. For example tables it generates following 
         queries.
@@ -0,0 +1,327 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSQLSTATISTICS_H
+#define DBSQLSTATISTICS_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "dbsqlexecobserver.h"
+
+namespace dbframework {
+
+/*!
+    The DBStatementStats class contains aggregated statistics of the execution of one SQL query. Latency percentiles are
+    estimated with the histogram of execution times with logarithmic buckets: bucket i contains calls that took less than
+    2^(i+1) microseconds and not less than 2^i microseconds. Percentiles are accurate up to the factor of 2.
+*/
+class DBStatementStats {
+public:
+    /*!
+        The number of histogram buckets.
+    */
+    static const int BucketCount = 32;
+    /*!
+        The number of calls.
+    */
+    size_t calls;
+    /*!
+        The number of failed calls.
+    */
+    size_t errors;
+    /*!
+        The number of records read.
+    */
+    size_t rows;
+    /*!
+        Total execution time in seconds.
+    */
+    double totalSeconds;
+    /*!
+        Maximum execution time in seconds.
+    */
+    double maxSeconds;
+    /*!
+        Histogram of execution times.
+    */
+    size_t histogram[BucketCount];
+    /*!
+        Constructs DBStatementStats with zero values.
+    */
+    DBStatementStats() : calls(0), errors(0), rows(0), totalSeconds(0), maxSeconds(0)
+    {
+        std::fill(histogram, histogram + BucketCount, 0);
+    };
+    /*!
+        Adds the result of one call to the statistics.
+        @param[in] info Phase timings and the result of execution.
+    */
+    void add(const DBSQLExecInfo& info)
+    {
+        ++calls;
+        if (!info.result)
+            ++errors;
+        rows += info.rows;
+        totalSeconds += info.totalSeconds;
+        maxSeconds = std::max(maxSeconds, info.totalSeconds);
+
+        double us = info.totalSeconds * 1e6;
+        int bucket = 0;
+        while ((bucket < BucketCount - 1) && (us >= 2)) {
+            us /= 2;
+            ++bucket;
+        }
+        ++histogram[bucket];
+    };
+    /*!
+        Get mean execution time.
+        @return Mean execution time in seconds.
+    */
+    double meanSeconds() const {return (calls > 0) ? totalSeconds / calls : 0;};
+    /*!
+        Get the number of records read per second of execution time.
+        @return The number of records per second.
+    */
+    double rowsPerSecond() const {return (totalSeconds > 0) ? rows / totalSeconds : 0;};
+    /*!
+        Get estimated execution time percentile.
+        @param[in] p Percentile in range [0, 1], for example 0.99.
+        @return Upper bound of the histogram bucket containing percentile in seconds, but no more than maxSeconds.
+    */
+    double percentile(double p) const
+    {
+        if (calls == 0)
+            return 0;
+
+        size_t rank = static_cast<size_t>(p * calls + 0.5);
+        size_t count = 0;
+        double upper = 2e-6;
+        for (int i = 0; i < BucketCount; ++i, upper *= 2) {
+            count += histogram[i];
+            if ((count >= rank) && (count > 0))
+                return std::min(upper, maxSeconds);
+        }
+        return maxSeconds;
+    };
+};
+
+/*!
+    The DBSQLStatistics template class is the DBSQLExecObserver descendant that aggregates statistics of SQL query execution
+    by normalized SQL query text, like pg_stat_statements in PostgreSQL. Install it with DBSQLExecutor::setObserver or
+    DBSQLExecutor::setGlobalObserver. DBSQLStatistics can be updated from many threads at once.
+
+    Inherit from DBSQLStatistics and implement sqlText to get fully functional DBSQLStatistics for a specific Dataset.
+
+    Template parameters.
+
+    Dataset - see DBSQLExecutor.
+*/
+template <class Dataset>
+class DBSQLStatistics : public DBSQLExecObserver<Dataset> {
+public:
+    /*!
+        Type of the container of statistics by normalized SQL query text.
+    */
+    typedef std::map<std::string, DBStatementStats> StatsMap;
+private:
+    mutable std::mutex m_mutex;
+    StatsMap m_stats;
+    std::unordered_map<std::string, DBStatementStats*> m_keys;
+
+    static const size_t KeyCacheSize = 4096;
+
+    typedef std::vector<std::pair<std::string, DBStatementStats> > StatsList;
+
+    StatsList sorted() const
+    {
+        StatsMap stats = snapshot();
+        StatsList result(stats.begin(), stats.end());
+        std::sort(result.begin(), result.end(), [](const typename StatsList::value_type& a, const typename StatsList::value_type& b) {
+            return a.second.totalSeconds > b.second.totalSeconds;
+        });
+        return result;
+    };
+    static std::string jsonString(const std::string& s)
+    {
+        std::string result = "\"";
+        for (std::string::const_iterator i = s.begin(); i != s.end(); ++i) {
+            unsigned char c = static_cast<unsigned char>(*i);
+            if ((c == '"') || (c == '\\')) {
+                result += '\\';
+                result += *i;
+            }
+            else if (c < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                result += buf;
+            }
+            else {
+                result += *i;
+            }
+        }
+        return result + "\"";
+    };
+protected:
+    /*!
+        This method must be implemented by the descendants. It must return SQL query text of the Dataset.
+        @param[in] ds Dataset object used for query execution.
+        @return SQL query text.
+    */
+    virtual std::string sqlText(Dataset& ds) = 0;
+    /*!
+        Normalizes SQL query text, so that queries that differ only in literal values and whitespace are aggregated together.
+        Default implementation replaces string and numeric literals with ? and replaces every sequence of whitespace
+        characters with one space.
+        @param[in] sql SQL query text.
+        @return Normalized SQL query text.
+    */
+    virtual std::string normalize(const std::string& sql) const
+    {
+        std::string result;
+        bool space = false;
+        result.reserve(sql.size());
+        for (std::string::size_type i = 0; i < sql.size();) {
+            unsigned char c = static_cast<unsigned char>(sql[i]);
+            if (std::isspace(c)) {
+                space = true;
+                ++i;
+                continue;
+            }
+            if (space && !result.empty())
+                result += ' ';
+            space = false;
+
+            unsigned char prev = result.empty() ? ' ' : static_cast<unsigned char>(result[result.size() - 1]);
+            if (c == '\'') {
+                for (++i; i < sql.size(); ++i) {
+                    if (sql[i] == '\'') {
+                        if ((i + 1 < sql.size()) && (sql[i + 1] == '\''))
+                            ++i;
+                        else
+                            break;
+                    }
+                }
+                ++i;
+                result += '?';
+            }
+            else if (std::isdigit(c) && !std::isalnum(prev) && (prev != '_') && (prev != '$')) {
+                while ((i < sql.size()) && (std::isalnum(static_cast<unsigned char>(sql[i])) || (sql[i] == '.')))
+                    ++i;
+                result += '?';
+            }
+            else {
+                result += sql[i];
+                ++i;
+            }
+        }
+        return result;
+    };
+public:
+    /*!
+        Adds the result of the call to the statistics of its normalized SQL query text. The statistics are looked up by
+        SQL query text in the hash table, so the text is normalized only on the first call. The hash table is cleared
+        when it holds 4096 texts, for example if queries include different literal values.
+        @param[in] ds Dataset object used for query execution.
+        @param[in] info Phase timings and the result of execution.
+    */
+    void finished(Dataset& ds, const DBSQLExecInfo& info)
+    {
+        std::string sql = sqlText(ds);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        typename std::unordered_map<std::string, DBStatementStats*>::iterator i = m_keys.find(sql);
+        if (i == m_keys.end()) {
+            if (m_keys.size() >= KeyCacheSize)
+                m_keys.clear();
+            DBStatementStats* stats = &m_stats[normalize(sql)];
+            i = m_keys.insert(std::make_pair(std::move(sql), stats)).first;
+        }
+        i->second->add(info);
+    };
+    /*!
+        Get the copy of the statistics.
+        @return Statistics by normalized SQL query text.
+    */
+    StatsMap snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    };
+    /*!
+        Clears the statistics.
+    */
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_keys.clear();
+        m_stats.clear();
+    };
+    /*!
+        Get the statistics as text, one SQL query per line, ordered by descending total execution time.
+        @return Statistics as text.
+    */
+    std::string text() const
+    {
+        StatsList stats = sorted();
+        std::ostringstream os;
+        os << "calls\terrors\trows\ttotal_ms\tmean_ms\tp50_ms\tp95_ms\tp99_ms\tmax_ms\trows_per_sec\tquery\n";
+        for (typename StatsList::const_iterator i = stats.begin(); i != stats.end(); ++i) {
+            const DBStatementStats& s = i->second;
+            os << s.calls << '\t' << s.errors << '\t' << s.rows << '\t' << s.totalSeconds * 1e3 << '\t'
+               << s.meanSeconds() * 1e3 << '\t' << s.percentile(0.5) * 1e3 << '\t' << s.percentile(0.95) * 1e3 << '\t'
+               << s.percentile(0.99) * 1e3 << '\t' << s.maxSeconds * 1e3 << '\t' << s.rowsPerSecond() << '\t'
+               << i->first << '\n';
+        }
+        return os.str();
+    };
+    /*!
+        Get the statistics as JSON array of objects, ordered by descending total execution time.
+        @return Statistics as JSON.
+    */
+    std::string json() const
+    {
+        StatsList stats = sorted();
+        std::ostringstream os;
+        os << '[';
+        for (typename StatsList::const_iterator i = stats.begin(); i != stats.end(); ++i) {
+            const DBStatementStats& s = i->second;
+            if (i != stats.begin())
+                os << ',';
+            os << "{\"query\":" << jsonString(i->first) << ",\"calls\":" << s.calls << ",\"errors\":" << s.errors
+               << ",\"rows\":" << s.rows << ",\"total_seconds\":" << s.totalSeconds << ",\"mean_seconds\":" << s.meanSeconds()
+               << ",\"p50_seconds\":" << s.percentile(0.5) << ",\"p95_seconds\":" << s.percentile(0.95)
+               << ",\"p99_seconds\":" << s.percentile(0.99) << ",\"max_seconds\":" << s.maxSeconds
+               << ",\"rows_per_second\":" << s.rowsPerSecond() << '}';
+        }
+        os << ']';
+        return os.str();
+    };
+};
+
+}
+
+#endif // DBSQLSTATISTICS_H
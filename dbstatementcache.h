@@ -0,0 +1,192 @@
+#ifndef DBSTATEMENTCACHE_H
+#define DBSTATEMENTCACHE_H
+
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace dbframework {
+
+/*!
+    The DBStatementCache class template keeps Dataset objects with prepared SQL queries, so that repeated execution
+    of the same SQL query with DBSQLExecutor::exec doesn't require parsing and planning the query again. Cached Dataset
+    objects are identified by the connection and the SQL query text. When the number of cached Dataset objects exceeds
+    the maximum size, the least recently used one is deallocated.
+
+    Inherit from DBStatementCache and implement prepare method to get fully functional DBStatementCache for a specific Dataset.
+
+    Template parameters.
+
+    Connection is the class that represents database connection. Connection is identified by the address of its instance, so
+    the same Connection instance must be passed to statement for the same connection.
+
+    S is a string type that is used to represent SQL query text. Must have copy constructor and operator <.
+
+    Dataset - see DBSQLExecutor.
+*/
+template <class Connection, class S, class Dataset>
+class DBStatementCache {
+private:
+    typedef std::pair<const Connection*, S> Key;
+    typedef std::list<std::pair<Key, Dataset*> > List;
+    typedef std::map<Key, typename List::iterator> Index;
+    List m_list;
+    Index m_index;
+    size_t m_maxSize;
+    size_t m_hits;
+    size_t m_misses;
+
+    DBStatementCache(const DBStatementCache&) = delete;
+    DBStatementCache& operator=(const DBStatementCache&) = delete;
+    void removeLast()
+    {
+        m_index.erase(m_list.back().first);
+        delete m_list.back().second;
+        m_list.pop_back();
+    };
+protected:
+    /*!
+        This method must be implemented by the descendants. It must allocate Dataset instance with delete-compatible
+        new operator and prepare it for execution of the SQL query.
+        @param[in] connection Connection which is used to execute the SQL query.
+        @param[in] sql SQL query text.
+        @return Pointer to prepared Dataset or nullptr if preparation failed.
+    */
+    virtual Dataset* prepare(Connection& connection, const S& sql) = 0;
+public:
+    /*!
+        Constructs empty DBStatementCache.
+        @param[in] maxSize The maximum number of cached Dataset instances. Zero is treated as one, because the returned Dataset
+        must stay in the cache.
+    */
+    DBStatementCache(size_t maxSize = 64) : m_maxSize((maxSize > 0) ? maxSize : 1), m_hits(0), m_misses(0) {};
+    /*!
+        Virtual destructor. Deallocates all cached Dataset instances.
+    */
+    virtual ~DBStatementCache()
+    {
+        clear();
+    };
+    /*!
+        Get Dataset with prepared SQL query. If the cache doesn't have Dataset for the connection and SQL query text, then
+        it is prepared by calling prepare and added to the cache.
+        The returned Dataset remains owned by DBStatementCache. The pointer remains valid until the next call to statement,
+        setMaxSize or clear, so the returned Dataset must not be used for nested queries with the same cache.
+        @param[in] connection Connection which is used to execute the SQL query.
+        @param[in] sql SQL query text.
+        @return Pointer to prepared Dataset or nullptr if preparation failed.
+    */
+    Dataset* statement(Connection& connection, const S& sql)
+    {
+        Key key(&connection, sql);
+        typename Index::iterator i = m_index.find(key);
+
+        if (i != m_index.end()) {
+            ++m_hits;
+            m_list.splice(m_list.begin(), m_list, i->second);
+            return i->second->second;
+        }
+
+        ++m_misses;
+        Dataset* ds = prepare(connection, sql);
+        if (ds != nullptr) {
+            m_list.push_front(std::make_pair(key, ds));
+            m_index[key] = m_list.begin();
+            while (m_list.size() > m_maxSize) {
+                removeLast();
+            }
+        }
+        return ds;
+    };
+    /*!
+        Get the maximum number of cached Dataset instances.
+        @return The maximum number of cached Dataset instances.
+    */
+    size_t maxSize() const {return m_maxSize;};
+    /*!
+        Set the maximum number of cached Dataset instances. Least recently used Dataset instances that exceed new maximum are
+        deallocated.
+        @param[in] maxSize The maximum number of cached Dataset instances. Zero is treated as one, because the returned Dataset
+        must stay in the cache.
+    */
+    void setMaxSize(size_t maxSize)
+    {
+        m_maxSize = (maxSize > 0) ? maxSize : 1;
+        while (m_list.size() > m_maxSize) {
+            removeLast();
+        }
+    };
+    /*!
+        Get the number of cached Dataset instances.
+        @return The number of cached Dataset instances.
+    */
+    size_t size() const {return m_list.size();};
+    /*!
+        Get the number of calls to statement that found Dataset in the cache.
+        @return The number of cache hits.
+    */
+    size_t hits() const {return m_hits;};
+    /*!
+        Get the number of calls to statement that didn't find Dataset in the cache.
+        @return The number of cache misses.
+    */
+    size_t misses() const {return m_misses;};
+    /*!
+        Sets cache hits and misses counters to zero.
+    */
+    void resetCounters()
+    {
+        m_hits = 0;
+        m_misses = 0;
+    };
+    /*!
+        Deallocates all cached Dataset instances.
+    */
+    void clear()
+    {
+        while (!m_list.empty()) {
+            removeLast();
+        }
+    };
+    /*!
+        Deallocates all cached Dataset instances for the connection. Call this method before closing the connection.
+        @param[in] connection Connection for which Dataset instances must be deallocated.
+    */
+    void clear(const Connection& connection)
+    {
+        for (typename List::iterator i = m_list.begin(); i != m_list.end();) {
+            if (i->first.first == &connection) {
+                m_index.erase(i->first);
+                delete i->second;
+                i = m_list.erase(i);
+            }
+            else {
+                ++i;
+            }
+        }
+    };
+};
+
+}
+
+#endif //DBSTATEMENTCACHE_H
@@ -0,0 +1,148 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSTATICBINDER_H
+#define DBSTATICBINDER_H
+
+#include "dbbinder.h"
+
+namespace dbframework {
+
+/*!
+    The DBStaticBindObject template class is the static counterpart of DBBindObject. Static binder is any class that has
+    non-virtual method void bind(Dataset& dataset), so that parameters binding is resolved at compile time. Inherit from
+    DBStaticBindObject and implement bind to create static binder for the members of some class instance.
+
+    Use DBBinderAdapter to pass static binder where DBBinder is required, or pass it to DBSQLExecutor::execStatic directly.
+
+    Template parameters.
+
+    Dataset - see DBBinder.
+
+    Object is the class which members are binded with the SQL query parameters.
+*/
+template <class Dataset, class Object>
+class DBStaticBindObject {
+protected:
+    /*!
+        Object instance which members are binded with SQL query parameters.
+     */
+    Object* m_object;
+public:
+    /*!
+        Creates DBStaticBindObject instance.
+        @param[in] object Pointer to Object instance which members are binded with SQL query parameters.
+        The DBStaticBindObject doesn't take ownership of object.
+     */
+    DBStaticBindObject(Object* object = nullptr) : m_object(object) {};
+    /*!
+        Get pointer to the object which members are binded with SQL query parameters.
+        @return Pointer to the object.
+    */
+    Object* object() {return m_object;};
+    /*!
+        Assosiate object which members are binded with SQL query parameters with DBStaticBindObject instance.
+        @param[in] object Pointer to Object instance. The DBStaticBindObject doesn't take ownership of object.
+    */
+    void setObject(Object* object) {m_object = object;};
+};
+
+/*!
+    The DBStaticBinders template class is the static counterpart of DBBinders. It binds SQL query parameters using nested
+    static binders in the order they are listed in template parameters.
+
+    Template parameters.
+
+    Dataset - see DBBinder.
+
+    Binders are the static binder classes.
+*/
+template <class Dataset, class... Binders>
+class DBStaticBinders;
+
+/*!
+    Specialization of DBStaticBinders without nested binders. Does nothing.
+*/
+template <class Dataset>
+class DBStaticBinders<Dataset> {
+public:
+    /*!
+        Does nothing.
+        @param[in] dataset Dataset object which is used to perform parameters binding.
+    */
+    void bind(Dataset& /*dataset*/) {};
+};
+
+/*!
+    Specialization of DBStaticBinders that binds parameters with the first nested binder and then with the rest of them.
+*/
+template <class Dataset, class Binder, class... Binders>
+class DBStaticBinders<Dataset, Binder, Binders...> {
+private:
+    Binder* m_binder;
+    DBStaticBinders<Dataset, Binders...> m_rest;
+public:
+    /*!
+        Creates DBStaticBinders.
+        @param[in] binder Pointer to the first nested binder.
+        @param[in] binders Pointers to the rest of nested binders.
+        The DBStaticBinders doesn't take ownership of binders.
+    */
+    DBStaticBinders(Binder* binder, Binders*... binders) : m_binder(binder), m_rest(binders...) {};
+    /*!
+        Binds SQL query parameters using all nested binders.
+        @param[in] dataset Dataset object which is used to perform parameters binding.
+    */
+    void bind(Dataset& dataset)
+    {
+        m_binder->bind(dataset);
+        m_rest.bind(dataset);
+    };
+};
+
+/*!
+    The DBBinderAdapter template class is the DBBinder descendant that binds parameters using static binder. Use it to pass
+    static binder where DBBinder is required.
+
+    Template parameters.
+
+    Dataset - see DBBinder.
+
+    Binder is the static binder class.
+*/
+template <class Dataset, class Binder>
+class DBBinderAdapter : public DBBinder<Dataset> {
+private:
+    Binder* m_binder;
+public:
+    /*!
+        Creates DBBinderAdapter.
+        @param[in] binder Pointer to the static binder. DBBinderAdapter doesn't take ownership of binder.
+    */
+    DBBinderAdapter(Binder* binder) : DBBinder<Dataset>(), m_binder(binder) {};
+    /*!
+        Binds SQL query parameters using static binder.
+        @param[in] dataset Dataset object which is used to perform parameters binding.
+    */
+    void bind(Dataset& dataset) {m_binder->bind(dataset);};
+};
+
+}
+
+#endif // DBSTATICBINDER_H
@@ -0,0 +1,261 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSTATICREADER_H
+#define DBSTATICREADER_H
+
+#include "dbreader.h"
+#include "dbread2object.h"
+
+namespace dbframework {
+
+/*!
+    The DBStaticReader template class is the base class of the static reader hierarchy. Static readers implement the same
+    reading algorithms as DBReader descendants, but they don't have virtual methods. Nested readers are passed to static
+    readers as template parameters, so all calls made while reading a record are resolved at compile time and can be inlined
+    by the compiler.
+
+    Static reader is any class that has methods:
+    - bool read(Dataset& ds) that reads data from the current record of the Dataset;
+    - void begin(Dataset& ds), see DBReader::begin;
+    - void end(Dataset& ds, bool ok), see DBReader::end.
+    Static reader may also have method DBReadStatus readRow(Dataset& ds), see DBReader::readRow. If it doesn't, read is used.
+    Static reader used to store data in the object (static object reader) must also have method void setObject(Object* obj).
+
+    Use DBReaderAdapter to pass static reader to DBSQLExecutor::exec or to existing DBReader descendants, or pass it to
+    DBSQLExecutor::execStatic directly. Use DBStaticReaderAdapter to use existing DBReader2Object descendants in static readers.
+
+    Template parameters.
+
+    Derived is the class inherited from DBStaticReader.
+
+    Dataset - see DBReader.
+*/
+template <class Derived, class Dataset>
+class DBStaticReader {
+protected:
+    /*!
+        Get reference to this instance as Derived.
+        @return Reference to Derived.
+    */
+    Derived& derived() {return static_cast<Derived&>(*this);};
+public:
+    /*!
+        Default implementation does nothing. Hide this method in Derived to resolve column indexes.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& /*ds*/) {};
+    /*!
+        Default implementation does nothing. Hide this method in Derived to release temporary memory after reading.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& /*ds*/, bool /*ok*/) {};
+};
+
+/*!
+    The DBStaticReader2Object template class is the static counterpart of DBReader2Object. Inherit from DBStaticReader2Object
+    and implement non-virtual method bool read(Dataset& ds) to create static object reader.
+
+    Template parameters.
+
+    Derived is the class inherited from DBStaticReader2Object.
+
+    Dataset - see DBReader.
+
+    Object is the class which instance is used to store data.
+*/
+template <class Derived, class Dataset, class Object>
+class DBStaticReader2Object : public DBStaticReader<Derived, Dataset> {
+protected:
+    /*!
+        Pointer to the object that is used to store read data.
+    */
+    Object* m_object;
+public:
+    /*!
+        Constructs DBStaticReader2Object not assosiated with the object.
+    */
+    DBStaticReader2Object() : m_object(nullptr) {};
+    /*!
+        Constructs DBStaticReader2Object assosiated with the object.
+        @param[in] obj Pointer to the object that is used to store read data. The DBStaticReader2Object doesn't take
+        ownership of obj.
+    */
+    DBStaticReader2Object(Object* obj) : m_object(obj) {};
+    /*!
+        Get pointer to object used to store read data.
+        @return Pointer to object used to store read data or nullptr if object wasn't assosiated.
+    */
+    Object* object() {return m_object;};
+    /*!
+        Assosiate object used to store read data with DBStaticReader2Object instance.
+        @param[in] obj Pointer to object used to store read data. The DBStaticReader2Object doesn't take
+        ownership of obj.
+    */
+    void setObject(Object* obj) {m_object = obj;};
+};
+
+/*!
+    The DBReaderAdapter template class is the DBReader descendant that reads data using static reader. Use it to pass
+    static reader where DBReader is required.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Reader is the static reader class.
+*/
+template <class Dataset, class Reader>
+class DBReaderAdapter : public DBReader<Dataset> {
+private:
+    Reader* m_reader;
+public:
+    /*!
+        Constructs DBReaderAdapter.
+        @param[in] reader Pointer to the static reader. DBReaderAdapter doesn't take ownership of reader.
+    */
+    DBReaderAdapter(Reader* reader) : DBReader<Dataset>(), m_reader(reader) {};
+    /*!
+        Reads data using static reader.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds) {return m_reader->read(ds);};
+    /*!
+        Reads data using static reader's readRow or read (see readRecord).
+        @param[in] ds Dataset to read from.
+        @return Status of reading.
+    */
+    DBReadStatus readRow(Dataset& ds) {return readRecord(*m_reader, ds);};
+    /*!
+        Passes the call to the static reader.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds) {m_reader->begin(ds);};
+    /*!
+        Passes the call to the static reader.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok) {m_reader->end(ds, ok);};
+};
+
+/*!
+    The DBReader2ObjectAdapter template class is the DBReader2Object descendant that reads data using static object reader.
+    Use it to pass static object reader to DBReader2Container and other DBReader descendants that require DBReader2Object.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object is the class which instance is used to store data.
+
+    Reader is the static object reader class.
+*/
+template <class Dataset, class Object, class Reader>
+class DBReader2ObjectAdapter : public DBReader2Object<Dataset, Object> {
+private:
+    Reader* m_reader;
+public:
+    /*!
+        Constructs DBReader2ObjectAdapter.
+        @param[in] reader Pointer to the static object reader. DBReader2ObjectAdapter doesn't take ownership of reader.
+    */
+    DBReader2ObjectAdapter(Reader* reader) : DBReader2Object<Dataset, Object>(), m_reader(reader) {};
+    /*!
+        Assosiates object with this instance and with the static object reader.
+        @param[in] obj Pointer to object used to store read data.
+    */
+    void setObject(Object* obj)
+    {
+        DBReader2Object<Dataset, Object>::setObject(obj);
+        m_reader->setObject(obj);
+    };
+    /*!
+        Reads data using static object reader.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds) {return m_reader->read(ds);};
+    /*!
+        Passes the call to the static object reader.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds) {m_reader->begin(ds);};
+    /*!
+        Passes the call to the static object reader.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok) {m_reader->end(ds, ok);};
+};
+
+/*!
+    The DBStaticReaderAdapter template class is the static object reader that reads data using DBReader2Object descendant.
+    Use it to pass existing DBReader2Object descendants to static readers. Every call to read and setObject is the virtual call.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object is the class which instance is used to store data.
+*/
+template <class Dataset, class Object>
+class DBStaticReaderAdapter : public DBStaticReader2Object<DBStaticReaderAdapter<Dataset, Object>, Dataset, Object> {
+private:
+    typedef DBStaticReader2Object<DBStaticReaderAdapter<Dataset, Object>, Dataset, Object> AncestorType;
+    DBReader2Object<Dataset, Object>* m_reader;
+public:
+    /*!
+        Constructs DBStaticReaderAdapter.
+        @param[in] reader Pointer to DBReader2Object descendant. DBStaticReaderAdapter doesn't take ownership of reader.
+    */
+    DBStaticReaderAdapter(DBReader2Object<Dataset, Object>* reader) : AncestorType(), m_reader(reader) {};
+    /*!
+        Assosiates object with this instance and with DBReader2Object descendant.
+        @param[in] obj Pointer to object used to store read data.
+    */
+    void setObject(Object* obj)
+    {
+        AncestorType::setObject(obj);
+        m_reader->setObject(obj);
+    };
+    /*!
+        Reads data using DBReader2Object descendant.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds) {return m_reader->read(ds);};
+    /*!
+        Passes the call to DBReader2Object descendant.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds) {m_reader->begin(ds);};
+    /*!
+        Passes the call to DBReader2Object descendant.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok) {m_reader->end(ds, ok);};
+};
+
+}
+
+#endif // DBSTATICREADER_H
@@ -0,0 +1,354 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSTATICREADER2ASSOCIATIVE_H
+#define DBSTATICREADER2ASSOCIATIVE_H
+
+#include "dbstaticreader2container.h"
+#include "dbreserve.h"
+
+namespace dbframework {
+
+/*!
+    The DBStaticReader2Associative template class is the static counterpart of DBReader2Associative. Derived class must
+    implement non-virtual method Object* objectByKey(const Key& key) with the same semantics as DBReader2Associative::objectByKey.
+    If objectByKey isn't public, Derived must declare DBStaticReader2Associative as friend.
+
+    Template parameters.
+
+    Derived is the class inherited from DBStaticReader2Associative.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2Associative.
+
+    Container - see DBReader2Associative.
+
+    Key - see DBReader2Associative.
+
+    ObjectReader is the static object reader class used to read Object data (see DBStaticReader).
+
+    KeyReader is the static object reader class used to read Key data.
+*/
+template <class Derived, class Dataset, class Object, class Container, class Key, class ObjectReader, class KeyReader>
+class DBStaticReader2Associative : public DBStaticReader2ContainerBase<Derived, Dataset, Object, Container, ObjectReader> {
+private:
+    typedef DBStaticReader2ContainerBase<Derived, Dataset, Object, Container, ObjectReader> AncestorType;
+protected:
+    /*!
+        Pointer to the static object reader used to read Key data.
+    */
+    KeyReader* m_keyReader;
+public:
+    /*!
+        Constructs DBStaticReader2Associative without assosiated container, ObjectReader and KeyReader instances.
+    */
+    DBStaticReader2Associative() : AncestorType(), m_keyReader(nullptr) {};
+    /*!
+        Constructs DBStaticReader2Associative with assosiated container, ObjectReader and KeyReader instances.
+        @param[in] container Pointer to the container that is used to store read data. The DBStaticReader2Associative doesn't take
+        ownership of container.
+        @param[in] objectReader Pointer to the ObjectReader instance that is used read Object data. The DBStaticReader2Associative
+        doesn't take ownership of the objectReader.
+        @param[in] keyReader Pointer to the KeyReader instance that is used to read Key data. The DBStaticReader2Associative
+        doesn't take ownership of the keyReader.
+    */
+    DBStaticReader2Associative(Container* container, ObjectReader* objectReader, KeyReader* keyReader) :
+        AncestorType(container, objectReader), m_keyReader(keyReader) {};
+    /*!
+        Get assosiated KeyReader instance.
+        @return Pointer to the assosiated KeyReader instance or nullptr if it wasn't assosiated.
+    */
+    KeyReader* keyReader() {return m_keyReader;};
+    /*!
+        Assosiate KeyReader instance with this DBStaticReader2Associative instance.
+        @param[in] reader Pointer to the KeyReader instance. The DBStaticReader2Associative doesn't take ownership of reader.
+    */
+    void setKeyReader(KeyReader* reader) {m_keyReader = reader;};
+    /*!
+        Passes the call to the assosiated ObjectReader and KeyReader instances.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        AncestorType::begin(ds);
+        if (m_keyReader != nullptr)
+            m_keyReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated ObjectReader and KeyReader instances.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        if (m_keyReader != nullptr)
+            m_keyReader->end(ds, ok);
+    };
+    /*!
+        Reads data like DBReader2Associative::read, calling Derived::objectByKey without virtual dispatch.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((m_keyReader == nullptr) || (AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        Key k;
+        bool result = false;
+
+        m_keyReader->setObject(&k);
+        if (m_keyReader->read(ds)) {
+            Object* obj = AncestorType::derived().objectByKey(k);
+            if (obj != nullptr) {
+                AncestorType::m_objectReader->setObject(obj);
+                result = AncestorType::m_objectReader->read(ds);
+            }
+        }
+        return result;
+    };
+};
+
+/*!
+    The DBStaticReader2STLAssociative template class is the static counterpart of DBReader2STLAssociative.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2STLAssociative.
+
+    Container - see DBReader2STLAssociative.
+
+    Key - see DBReader2STLAssociative.
+
+    ObjectReader is the static object reader class used to read Object data (see DBStaticReader).
+
+    KeyReader is the static object reader class used to read Key data.
+*/
+template <class Dataset, class Object, class Container, class Key, class ObjectReader, class KeyReader>
+class DBStaticReader2STLAssociative : public DBStaticReader2Associative<DBStaticReader2STLAssociative<Dataset, Object, Container, Key,
+    ObjectReader, KeyReader>, Dataset, Object, Container, Key, ObjectReader, KeyReader> {
+private:
+    typedef DBStaticReader2Associative<DBStaticReader2STLAssociative<Dataset, Object, Container, Key, ObjectReader, KeyReader>,
+        Dataset, Object, Container, Key, ObjectReader, KeyReader> AncestorType;
+    friend AncestorType;
+protected:
+    /*!
+        Implements objectByKey using Container's operator [].
+        @param key Key value for required Object instance.
+        @return Pointer to Object instance.
+    */
+    Object* objectByKey(const Key& key)
+    {
+        return &((*AncestorType::m_container)[key]);
+    };
+public:
+    /*!
+        Constructs DBStaticReader2STLAssociative without assosiated container, ObjectReader and KeyReader instances.
+    */
+    DBStaticReader2STLAssociative() : AncestorType() {};
+    /*!
+        Constructs DBStaticReader2STLAssociative with assosiated container, ObjectReader and KeyReader instances.
+        @param[in] container Pointer to the container that is used to store read data. The DBStaticReader2STLAssociative doesn't take
+        ownership of container.
+        @param[in] objectReader Pointer to the ObjectReader instance. The DBStaticReader2STLAssociative doesn't take ownership of it.
+        @param[in] keyReader Pointer to the KeyReader instance. The DBStaticReader2STLAssociative doesn't take ownership of it.
+    */
+    DBStaticReader2STLAssociative(Container* container, ObjectReader* objectReader, KeyReader* keyReader) :
+        AncestorType(container, objectReader, keyReader) {};
+};
+
+/*!
+    The DBStaticReader2STLAssociativePtr template class is the static counterpart of DBReader2STLAssociativePtr.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2STLAssociativePtr.
+
+    Container - see DBReader2STLAssociativePtr.
+
+    Key - see DBReader2STLAssociativePtr.
+
+    ObjectPtr - see DBReader2STLAssociativePtr.
+
+    ObjectReader is the static object reader class used to read Object data (see DBStaticReader).
+
+    KeyReader is the static object reader class used to read Key data.
+
+    Factory - see DBReader2STLAssociativePtr.
+*/
+template <class Dataset, class Object, class Container, class Key, class ObjectPtr, class ObjectReader, class KeyReader,
+    class Factory = DBNewObjectFactory<Object, ObjectPtr> >
+class DBStaticReader2STLAssociativePtr : public DBStaticReader2Associative<DBStaticReader2STLAssociativePtr<Dataset, Object, Container,
+    Key, ObjectPtr, ObjectReader, KeyReader, Factory>, Dataset, Object, Container, Key, ObjectReader, KeyReader> {
+private:
+    typedef DBStaticReader2Associative<DBStaticReader2STLAssociativePtr<Dataset, Object, Container, Key, ObjectPtr, ObjectReader,
+        KeyReader, Factory>, Dataset, Object, Container, Key, ObjectReader, KeyReader> AncestorType;
+    friend AncestorType;
+    Factory m_factory;
+protected:
+    /*!
+        Implements objectByKey like DBReader2STLAssociativePtr::objectByKey.
+        @param key Key value for required Object instance.
+        @return Pointer to Object instance.
+    */
+    Object* objectByKey(const Key& key)
+    {
+        ObjectPtr& p = (*AncestorType::m_container)[key];
+        if (p == nullptr)
+            p = m_factory.create();
+        return &(*p);
+    };
+public:
+    /*!
+        Constructs DBStaticReader2STLAssociativePtr without assosiated container, ObjectReader and KeyReader instances.
+    */
+    DBStaticReader2STLAssociativePtr() : AncestorType() {};
+    /*!
+        Constructs DBStaticReader2STLAssociativePtr with assosiated container, ObjectReader and KeyReader instances.
+        @param[in] container Pointer to the container that is used to store read data. The DBStaticReader2STLAssociativePtr doesn't take
+        ownership of container.
+        @param[in] objectReader Pointer to the ObjectReader instance. The DBStaticReader2STLAssociativePtr doesn't take ownership of it.
+        @param[in] keyReader Pointer to the KeyReader instance. The DBStaticReader2STLAssociativePtr doesn't take ownership of it.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBStaticReader2STLAssociativePtr(Container* container, ObjectReader* objectReader, KeyReader* keyReader,
+        const Factory& factory = Factory()) : AncestorType(container, objectReader, keyReader), m_factory(factory) {};
+    /*!
+        Get factory used to create Object instances.
+        @return Reference to the factory.
+    */
+    Factory& factory() {return m_factory;};
+};
+
+/*!
+    The DBStaticReader2IndexedSTLContainerPtr template class is the static counterpart of DBReader2IndexedSTLContainerPtr.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2IndexedSTLContainerPtr.
+
+    Container - see DBReader2IndexedSTLContainerPtr.
+
+    Key - see DBReader2IndexedSTLContainerPtr.
+
+    ObjectPtr - see DBReader2IndexedSTLContainerPtr.
+
+    Index - see DBReader2IndexedSTLContainerPtr.
+
+    ObjectReader is the static object reader class used to read Object data (see DBStaticReader).
+
+    KeyReader is the static object reader class used to read Key data.
+
+    Factory - see DBReader2IndexedSTLContainerPtr.
+*/
+template <class Dataset, class Object, class Container, class Key, class ObjectPtr, class Index, class ObjectReader, class KeyReader,
+    class Factory = DBNewObjectFactory<Object, ObjectPtr> >
+class DBStaticReader2IndexedSTLContainerPtr : public DBStaticReader2Associative<DBStaticReader2IndexedSTLContainerPtr<Dataset, Object,
+    Container, Key, ObjectPtr, Index, ObjectReader, KeyReader, Factory>, Dataset, Object, Container, Key, ObjectReader, KeyReader> {
+private:
+    typedef DBStaticReader2Associative<DBStaticReader2IndexedSTLContainerPtr<Dataset, Object, Container, Key, ObjectPtr, Index,
+        ObjectReader, KeyReader, Factory>, Dataset, Object, Container, Key, ObjectReader, KeyReader> AncestorType;
+    friend AncestorType;
+    Index m_index;
+    Factory m_factory;
+    bool m_keepIndex;
+protected:
+    /*!
+        Implements objectByKey like DBReader2IndexedSTLContainerPtr::objectByKey.
+        @param key Key value for required Object instance.
+        @return Pointer to Object instance.
+    */
+    Object* objectByKey(const Key& key)
+    {
+        ObjectPtr& p = m_index[key];
+        if (p == nullptr) {
+            p = m_factory.create();
+            AncestorType::m_container->push_back(p);
+        }
+        return &(*p);
+    };
+public:
+    /*!
+        Constructs DBStaticReader2IndexedSTLContainerPtr without assosiated container, ObjectReader and KeyReader instances.
+    */
+    DBStaticReader2IndexedSTLContainerPtr() : AncestorType(), m_keepIndex(false) {};
+    /*!
+        Constructs DBStaticReader2IndexedSTLContainerPtr with assosiated container, ObjectReader and KeyReader instances.
+        @param[in] container Pointer to the container that is used to store read data. The DBStaticReader2IndexedSTLContainerPtr
+        doesn't take ownership of container.
+        @param[in] objectReader Pointer to the ObjectReader instance. The DBStaticReader2IndexedSTLContainerPtr doesn't take ownership of it.
+        @param[in] keyReader Pointer to the KeyReader instance. The DBStaticReader2IndexedSTLContainerPtr doesn't take ownership of it.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBStaticReader2IndexedSTLContainerPtr(Container* container, ObjectReader* objectReader, KeyReader* keyReader,
+        const Factory& factory = Factory()) : AncestorType(container, objectReader, keyReader), m_factory(factory), m_keepIndex(false) {};
+    /*!
+        Get factory used to create Object instances.
+        @return Reference to the factory.
+    */
+    Factory& factory() {return m_factory;};
+    /*!
+        Clears internal index. See DBReader2IndexedSTLContainerPtr::clearIndex.
+    */
+    void clearIndex()
+    {
+        m_index = Index();
+    };
+    /*!
+        Reserves space in the internal index. See DBReader2IndexedSTLContainerPtr::reserveIndex.
+        @param[in] count Expected number of Key values.
+    */
+    void reserveIndex(size_t count)
+    {
+        reserveContainer(m_index, count);
+    };
+    /*!
+        Get the mode of internal index releasing. See DBReader2IndexedSTLContainerPtr::keepIndex.
+        @return True if the index is kept after reading SQL query execution result.
+    */
+    bool keepIndex() const {return m_keepIndex;};
+    /*!
+        Set the mode of internal index releasing. See DBReader2IndexedSTLContainerPtr::setKeepIndex.
+        @param[in] keep If false (default), the index is released by end.
+    */
+    void setKeepIndex(bool keep) {m_keepIndex = keep;};
+    /*!
+        Passes the call to the assosiated readers and releases internal index unless keepIndex is set.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        AncestorType::end(ds, ok);
+        if (!m_keepIndex)
+            clearIndex();
+    };
+};
+
+}
+
+#endif // DBSTATICREADER2ASSOCIATIVE_H
@@ -0,0 +1,227 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSTATICREADER2CONTAINER_H
+#define DBSTATICREADER2CONTAINER_H
+
+#include <utility>
+#include "dbstaticreader.h"
+#include "dbobjectfactory.h"
+#include "dbcontainerelement.h"
+
+namespace dbframework {
+
+/*!
+    The DBStaticReader2ContainerBase template class is the static counterpart of DBReader2ContainerBase. It is the base class
+    for static readers that store data in the container of objects. Usually you shouldn't inherit from DBStaticReader2ContainerBase.
+    It is for dbframework internal use.
+
+    Template parameters.
+
+    Derived is the class inherited from DBStaticReader2ContainerBase.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2ContainerBase.
+
+    Container - see DBReader2ContainerBase.
+
+    ObjectReader is the static object reader class used to read Object data (see DBStaticReader).
+*/
+template <class Derived, class Dataset, class Object, class Container, class ObjectReader>
+class DBStaticReader2ContainerBase : public DBStaticReader<Derived, Dataset> {
+protected:
+    /*!
+        Pointer to the container used to store data.
+    */
+    Container* m_container;
+    /*!
+        Pointer to the static object reader used to read Object data.
+    */
+    ObjectReader* m_objectReader;
+public:
+    /*!
+        Constructs DBStaticReader2ContainerBase without assosiated container and ObjectReader instance.
+    */
+    DBStaticReader2ContainerBase() : m_container(nullptr), m_objectReader(nullptr) {};
+    /*!
+        Constructs DBStaticReader2ContainerBase with assosiated container and ObjectReader instance.
+        @param[in] container Pointer to the container that is used to store read data. The DBStaticReader2ContainerBase doesn't take
+        ownership of the container.
+        @param[in] reader Pointer to the ObjectReader instance used to read Object data. DBStaticReader2ContainerBase doesn't take ownership
+        of the reader.
+    */
+    DBStaticReader2ContainerBase(Container* container, ObjectReader* reader) : m_container(container), m_objectReader(reader) {};
+    /*!
+        Get pointer to the container used to store data.
+        @return Pointer to the container used to store data or nullptr if container wasn't assosiated.
+    */
+    Container* container() {return m_container;};
+    /*!
+        Assosiate container used to store data with DBStaticReader2ContainerBase instance.
+        @param[in] container Pointer to the container used to store data. The DBStaticReader2ContainerBase doesn't take
+        ownership of the container.
+    */
+    void setContainer(Container* container) {m_container = container;};
+    /*!
+        Get ObjectReader instance used to read Object data.
+        @return Pointer to ObjectReader instance or nullptr if it wasn't assosiated.
+    */
+    ObjectReader* reader() {return m_objectReader;};
+    /*!
+        Assosiate ObjectReader instance used to read Object data with DBStaticReader2ContainerBase instance.
+        @param[in] reader Pointer ObjectReader instance. DBStaticReader2ContainerBase doesn't take ownership of reader.
+    */
+    void setReader(ObjectReader* reader) {m_objectReader = reader;};
+    /*!
+        Passes the call to the assosiated ObjectReader instance.
+        @param[in] ds Dataset containing SQL query execution result.
+    */
+    void begin(Dataset& ds)
+    {
+        if (m_objectReader != nullptr)
+            m_objectReader->begin(ds);
+    };
+    /*!
+        Passes the call to the assosiated ObjectReader instance.
+        @param[in] ds Dataset containing SQL query execution result.
+        @param[in] ok Result of reading, see DBReader::end.
+    */
+    void end(Dataset& ds, bool ok)
+    {
+        if (m_objectReader != nullptr)
+            m_objectReader->end(ds, ok);
+    };
+};
+
+/*!
+    The DBStaticReader2STLContainer template class is the static counterpart of DBReader2STLContainer.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2STLContainer.
+
+    Container - see DBReader2STLContainer.
+
+    ObjectReader is the static object reader class used to read Object data (see DBStaticReader).
+*/
+template <class Dataset, class Object, class Container, class ObjectReader>
+class DBStaticReader2STLContainer : public DBStaticReader2ContainerBase<DBStaticReader2STLContainer<Dataset, Object, Container, ObjectReader>,
+    Dataset, Object, Container, ObjectReader> {
+private:
+    typedef DBStaticReader2ContainerBase<DBStaticReader2STLContainer<Dataset, Object, Container, ObjectReader>,
+        Dataset, Object, Container, ObjectReader> AncestorType;
+public:
+    /*!
+        Constructs DBStaticReader2STLContainer without assosiated container and ObjectReader instance.
+    */
+    DBStaticReader2STLContainer() : AncestorType() {};
+    /*!
+        Constructs DBStaticReader2STLContainer with assosiated container and ObjectReader instance.
+        @param[in] container Pointer to the container that is used to store read data. The DBStaticReader2STLContainer doesn't take
+        ownership of container.
+        @param[in] reader Pointer to the ObjectReader instance used to read Object data. DBStaticReader2STLContainer doesn't take ownership
+        of reader.
+    */
+    DBStaticReader2STLContainer(Container* container, ObjectReader* reader) : AncestorType(container, reader) {};
+    /*!
+        Reads data like DBReader2STLContainer::read.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        return readContainerElement<Object>(*AncestorType::m_container, *AncestorType::m_objectReader, ds);
+    };
+};
+
+/*!
+    The DBStaticReader2STLContainerPtr template class is the static counterpart of DBReader2STLContainerPtr.
+
+    Template parameters.
+
+    Dataset - see DBReader.
+
+    Object - see DBReader2STLContainerPtr.
+
+    Container - see DBReader2STLContainerPtr.
+
+    ObjectPtr - see DBReader2STLContainerPtr.
+
+    ObjectReader is the static object reader class used to read Object data (see DBStaticReader).
+
+    Factory - see DBReader2STLContainerPtr.
+*/
+template <class Dataset, class Object, class Container, class ObjectPtr, class ObjectReader,
+    class Factory = DBNewObjectFactory<Object, ObjectPtr> >
+class DBStaticReader2STLContainerPtr : public DBStaticReader2ContainerBase<DBStaticReader2STLContainerPtr<Dataset, Object, Container,
+    ObjectPtr, ObjectReader, Factory>, Dataset, Object, Container, ObjectReader> {
+private:
+    typedef DBStaticReader2ContainerBase<DBStaticReader2STLContainerPtr<Dataset, Object, Container, ObjectPtr, ObjectReader, Factory>,
+        Dataset, Object, Container, ObjectReader> AncestorType;
+    Factory m_factory;
+public:
+    /*!
+        Constructs DBStaticReader2STLContainerPtr without assosiated container and ObjectReader instance.
+    */
+    DBStaticReader2STLContainerPtr() : AncestorType() {};
+    /*!
+        Constructs DBStaticReader2STLContainerPtr with assosiated container and ObjectReader instance.
+        @param[in] container Pointer to the container that is used to store read data. The DBStaticReader2STLContainerPtr doesn't take
+        ownership of container.
+        @param[in] reader Pointer to the ObjectReader instance used to read Object data. DBStaticReader2STLContainerPtr doesn't take ownership
+        of reader.
+        @param[in] factory Factory used to create Object instances.
+    */
+    DBStaticReader2STLContainerPtr(Container* container, ObjectReader* reader, const Factory& factory = Factory()) :
+        AncestorType(container, reader), m_factory(factory) {};
+    /*!
+        Get factory used to create Object instances.
+        @return Reference to the factory.
+    */
+    Factory& factory() {return m_factory;};
+    /*!
+        Reads data like DBReader2STLContainerPtr::read.
+        @param[in] ds Dataset to read from.
+        @return Returns true if success.
+    */
+    bool read(Dataset& ds)
+    {
+        if ((AncestorType::m_objectReader == nullptr) || (AncestorType::m_container == nullptr))
+            return false;
+
+        ObjectPtr p = m_factory.create();
+        AncestorType::m_objectReader->setObject(&(*p));
+        if (!AncestorType::m_objectReader->read(ds)) {
+            m_factory.destroy(p);
+            return false;
+        }
+        AncestorType::m_container->push_back(std::move(p));
+        return true;
+    };
+};
+
+}
+
+#endif // DBSTATICREADER2CONTAINER_H
@@ -19,6 +19,7 @@ TEMPLATE = app
 SOURCES += main.cpp \
     mydatabase.cpp \
     testtypes.cpp \
+    testschema.cpp \
     mybinders.cpp \
     myreaders.cpp \
     mydescriptors.cpp
@@ -26,6 +27,7 @@ SOURCES += main.cpp \
 
 HEADERS += \
     mydatabase.h \
-    mydescriptors.h
+    mydescriptors.h \
+    testschema.h
 
 INCLUDEPATH += ..
@@ -4,36 +4,10 @@
 #include <QVariant>
 #include "mybinders.h"
 #include "mydescriptors.h"
+#include "testschema.h"
 
 using namespace dbframework;
 
-const char* scriptDBCreate[] = {
-    "drop table if exists tran",
-
-    "drop table if exists account",
-
-    "drop table if exists customer",
-
-    "create table customer (\
-    id integer primary key,\
-    name text not null)",
-
-    "create table account (\
-    id integer primary key,\
-    ref_customer integer not null,\
-    constraint customer_fk foreign key(ref_customer) references customer(id) \
-    on update restrict on delete restrict)",
-
-    "create table tran (\
-    id integer primary key,\
-    ref_account integer not null,\
-    amount integer not null,\
-    constraint account_fk foreign key(ref_account) references account(id) \
-    on update restrict on delete restrict)",
-
-    nullptr
-};
-
 bool MySQLExec::executeQuery(QSqlQuery& ds)
 {
     return ds.exec();
@@ -44,7 +18,32 @@ bool MySQLExec::next(QSqlQuery& ds)
     return ds.next();
 }
 
-MyDatabase::MyDatabase()
+bool MySQLExec::beginTransaction(QSqlQuery& /*ds*/)
+{
+    return (db == nullptr) || db->transaction();
+}
+
+bool MySQLExec::commitTransaction(QSqlQuery& /*ds*/)
+{
+    return (db == nullptr) || db->commit();
+}
+
+bool MySQLExec::rollbackTransaction(QSqlQuery& /*ds*/)
+{
+    return (db == nullptr) || db->rollback();
+}
+
+QSqlQuery* MyStatementCache::prepare(QSqlDatabase& connection, const std::wstring& sql)
+{
+    QSqlQuery* q = new QSqlQuery(connection);
+    if (!q->prepare(QString::fromStdWString(sql))) {
+        delete q;
+        q = nullptr;
+    }
+    return q;
+}
+
+MyDatabase::MyDatabase() : executor(&db)
 {
 }
 
@@ -86,44 +85,45 @@ bool MyDatabase::fillDB(int customerCnt, int accountCnt,
     QTime midnight(0,0,0);
     qsrand(midnight.secsTo(QTime::currentTime()));
 
-    QSqlQuery q(db);
-
     if (result)
         result = db.transaction();
 
     if (result) {
-        //fill customer        
-        Customer c;
-        for (int i = 0; (i < customerCnt) && result; ++i) {            
-            c.id = i;
-            c.name = QString(QString("customer") + QString::number(i)).toStdWString();            
-            result = execSql(SQLGen.insert(&DescriptorCustomer, true).c_str(), nullptr, &CustomerBinder(&c));
+        //fill customer
+        CustomerVector customers(customerCnt);
+        for (int i = 0; i < customerCnt; ++i) {
+            customers[i].id = i;
+            customers[i].name = QString(QString("customer") + QString::number(i)).toStdWString();
         }
+        CustomerBinder binder(nullptr);
+        result = execBatch(SQLGen.insert(&DescriptorCustomer, true), &binder, customers.begin(), customers.end(), 0);
     }
 
     if (result) {
-        Account acc;
-        //fill account        
-        for (int i = 0; (i < accountCnt) && result; ++i) {            
-            acc.id = i;
-            acc.ref_customer = qrand() % customerCnt;
-            result = execSql(SQLGen.insert(&DescriptorAccount, true).c_str(), nullptr, &AccountBinder(&acc));
+        //fill account
+        std::vector<Account> accounts(accountCnt);
+        for (int i = 0; i < accountCnt; ++i) {
+            accounts[i].id = i;
+            accounts[i].ref_customer = qrand() % customerCnt;
         }
+        AccountBinder binder(nullptr);
+        result = execBatch(SQLGen.insert(&DescriptorAccount, true), &binder, accounts.begin(), accounts.end(), 0);
     }
 
     if (result) {
         //fill tran
-        Transaction t;
-        for (int i = 0; (i < tranCnt) && result; ++i) {
-            t.id = i;
-            t.ref_account = qrand() % accountCnt;
-            t.amount = 1 + qrand() % 10;
-            result = execSql(SQLGen.insert(&DescriptorTransaction, true).c_str(), nullptr, &TransactionBinder(&t));
+        std::vector<Transaction> trans(tranCnt);
+        for (int i = 0; i < tranCnt; ++i) {
+            trans[i].id = i;
+            trans[i].ref_account = qrand() % accountCnt;
+            trans[i].amount = 1 + qrand() % 10;
         }
+        TransactionBinder binder(nullptr);
+        result = execBatch(SQLGen.insert(&DescriptorTransaction, true), &binder, trans.begin(), trans.end(), 0);
     }
 
     if (result) {
-        db.commit();
+        result = db.commit();
     }
     else {
         db.rollback();
@@ -134,22 +134,18 @@ bool MyDatabase::fillDB(int customerCnt, int accountCnt,
 
 bool MyDatabase::execSql(const wchar_t *sql, DBReader<QSqlQuery>* reader, DBBinder<QSqlQuery>* binder)
 {
-    QSqlQuery q(db);
-    bool result = q.prepare(QString::fromStdWString(sql));
+    QSqlQuery* q = statements.statement(db, sql);
+    bool result = (q != nullptr);
 
-    if (result)
-        result = MySQLExec().exec(q, binder, reader);
+    if (result) {
+        result = executor.exec(*q, binder, reader);
+        q->finish();
+    }
 
     return result;
 }
 
 bool MyDatabase::execSql(const char *sql, DBReader<QSqlQuery>* reader, DBBinder<QSqlQuery>* binder)
 {
-    QSqlQuery q(db);
-    bool result = q.prepare(QString::fromStdString(sql));
-
-    if (result)
-        result = MySQLExec().exec(q, binder, reader);
-
-    return result;
+    return execSql(QString::fromStdString(sql).toStdWString().c_str(), reader, binder);
 }
@@ -3,22 +3,46 @@
 
 #include <QString>
 #include <QSqlDatabase>
+#include <QSqlQuery>
+#include <string>
 #include "dbframework.h"
 
 class MySQLExec : public dbframework::DBSQLExecutor<QSqlQuery>
 {
+private:
+    QSqlDatabase* db;
 protected:
     bool executeQuery(QSqlQuery& ds);
     bool next(QSqlQuery& ds);
+    bool beginTransaction(QSqlQuery& ds);
+    bool commitTransaction(QSqlQuery& ds);
+    bool rollbackTransaction(QSqlQuery& ds);
+public:
+    MySQLExec(QSqlDatabase* database = nullptr) : db(database) {};
+};
+
+class MyStatementCache : public dbframework::DBStatementCache<QSqlDatabase, std::wstring, QSqlQuery>
+{
+protected:
+    QSqlQuery* prepare(QSqlDatabase& connection, const std::wstring& sql);
 };
 
 class MyDatabase
 {
 private:
     QSqlDatabase db;
+    MyStatementCache statements;
+    MySQLExec executor;
     bool execScript(const char **script);
     bool execSql(QString sql);
     bool fillDB(int customerCnt, int accountCnt, int tranCnt);
+    template <class Object, class Iterator>
+    bool execBatch(const std::string& sql, dbframework::DBBindObject<QSqlQuery, Object>* binder, Iterator first, Iterator last,
+                   size_t commitSize = 1000)
+    {
+        QSqlQuery* q = statements.statement(db, QString::fromStdString(sql).toStdWString());
+        return (q != nullptr) && executor.execBatch(*q, binder, first, last, commitSize);
+    };
 public:
     MyDatabase();
     bool open(wchar_t* fileName);
@@ -1,48 +1,98 @@
 #include "myreaders.h"
 #include <QVariant>
 #include <QSqlQuery>
+#include <QSqlRecord>
 
+int QColumns::indexOf(QSqlQuery& ds, const QString& name) const
+{
+    return ds.record().indexOf(name);
+}
 
-bool checkIdField(QString name, QSqlQuery &ds, int* id)
+bool checkIdField(int index, QSqlQuery &ds, int* id)
 {
-    QVariant v = ds.value(name);
+    QVariant v = ds.value(index);
     bool result =(v.isValid() && !v.isNull());
     if (result)
         *id = v.toInt();
     return result;
 }
 
+void Reader2Customer::addColumns()
+{
+    colId = columns.add("customer_id");
+    colName = columns.add("customer_name");
+}
+
+void Reader2Customer::begin(QSqlQuery& ds)
+{
+    columns.resolve(ds);
+}
+
 bool Reader2Customer::read(QSqlQuery& ds)
 {
-    bool result = checkIdField("customer_id", ds, &m_object->id);
+    bool result = checkIdField(columns[colId], ds, &m_object->id);
     if (result)
-        m_object->name = ds.value("customer_name").toString().toStdWString();
+        m_object->name = ds.value(columns[colName]).toString().toStdWString();
     return result;
 }
 
+void Reader2Account::addColumns()
+{
+    colId = columns.add("account_id");
+    colRefCustomer = columns.add("account_ref_customer");
+}
+
+void Reader2Account::begin(QSqlQuery& ds)
+{
+    columns.resolve(ds);
+}
+
 bool Reader2Account::read(QSqlQuery& ds)
 {
-    bool result = checkIdField("account_id", ds, &m_object->id);
+    bool result = checkIdField(columns[colId], ds, &m_object->id);
     if (result)
-        m_object->ref_customer = ds.value("account_ref_customer").toInt();
+        m_object->ref_customer = ds.value(columns[colRefCustomer]).toInt();
     return result;
 }
 
+void Reader2Transaction::addColumns()
+{
+    colId = columns.add("tran_id");
+    colRefAccount = columns.add("tran_ref_account");
+    colAmount = columns.add("tran_amount");
+}
+
+void Reader2Transaction::begin(QSqlQuery& ds)
+{
+    columns.resolve(ds);
+}
+
 bool Reader2Transaction::read(QSqlQuery& ds)
 {
-    bool result = checkIdField("tran_id", ds, &m_object->id);
+    bool result = checkIdField(columns[colId], ds, &m_object->id);
     if (result) {
-        m_object->ref_account = ds.value("tran_ref_account").toInt();
-        m_object->amount = ds.value("tran_amount").toInt();
+        m_object->ref_account = ds.value(columns[colRefAccount]).toInt();
+        m_object->amount = ds.value(columns[colAmount]).toInt();
     }
     return result;
 }
 
+void Reader2AccountWithTrans::begin(QSqlQuery& ds)
+{
+    readAccount.begin(ds);
+    readTransactions.begin(ds);
+}
+
+void Reader2AccountWithTrans::end(QSqlQuery& ds, bool ok)
+{
+    readAccount.end(ds, ok);
+    readTransactions.end(ds, ok);
+}
+
 bool Reader2AccountWithTrans::read(QSqlQuery& ds)
 {
     readAccount.setObject(&m_object->account);
     readTransactions.setContainer(&m_object->transactions);
-    readTransactions.setReader(&readTransaction);
 
     bool result = readAccount.read(ds);
     if (result) {
@@ -51,18 +101,39 @@ bool Reader2AccountWithTrans::read(QSqlQuery& ds)
     return result;
 }
 
+void QKeyReader::begin(QSqlQuery& ds)
+{
+    index = ds.record().indexOf(field);
+}
+
 bool QKeyReader::read(QSqlQuery &ds)
 {
-    return checkIdField(field, ds, m_object);
+    return checkIdField(index, ds, m_object);
 }
 
-bool Reader2CustomerFullInfo::read(QSqlQuery &ds)
+void Reader2CustomerFullInfo::setReaders()
 {
-    readCustomer.setObject(m_object);
-    readAccounts.setContainer(&m_object->accounts);
     readAccounts.setReader(&readAccount);
     readAccounts.setKeyReader(&readKey);
     readKey.field = "account_id";
+}
+
+void Reader2CustomerFullInfo::begin(QSqlQuery& ds)
+{
+    readCustomer.begin(ds);
+    readAccounts.begin(ds);
+}
+
+void Reader2CustomerFullInfo::end(QSqlQuery& ds, bool ok)
+{
+    readCustomer.end(ds, ok);
+    readAccounts.end(ds, ok);
+}
+
+bool Reader2CustomerFullInfo::read(QSqlQuery &ds)
+{
+    readCustomer.setObject(m_object);
+    readAccounts.setContainer(&m_object->accounts);
 
     bool result = readCustomer.read(ds);
     if (result) {
@@ -6,25 +6,48 @@
 #include <QSqlQuery>
 #include <QString>
 
+class QColumns : public dbframework::DBColumns<QSqlQuery, QString, int> {
+protected:
+    int indexOf(QSqlQuery& ds, const QString& name) const;
+};
 
 class Reader2Customer : public dbframework::DBReader2Object<QSqlQuery, Customer> {
+private:
+    QColumns columns;
+    int colId;
+    int colName;
+    void addColumns();
 public:
-    Reader2Customer() : DBReader2Object<QSqlQuery, Customer>(){};
-    Reader2Customer(Customer* c) : DBReader2Object<QSqlQuery, Customer>(c){};
+    Reader2Customer() : DBReader2Object<QSqlQuery, Customer>(){addColumns();};
+    Reader2Customer(Customer* c) : DBReader2Object<QSqlQuery, Customer>(c){addColumns();};
+    void begin(QSqlQuery& ds);
     bool read(QSqlQuery& ds);
 };
 
 class Reader2Account : public dbframework::DBReader2Object<QSqlQuery, Account> {
+private:
+    QColumns columns;
+    int colId;
+    int colRefCustomer;
+    void addColumns();
 public:
-    Reader2Account() : DBReader2Object<QSqlQuery, Account>(){};
-    Reader2Account(Account* a) : DBReader2Object<QSqlQuery, Account>(a){};
+    Reader2Account() : DBReader2Object<QSqlQuery, Account>(){addColumns();};
+    Reader2Account(Account* a) : DBReader2Object<QSqlQuery, Account>(a){addColumns();};
+    void begin(QSqlQuery& ds);
     bool read(QSqlQuery& ds);
 };
 
 class Reader2Transaction : public dbframework::DBReader2Object<QSqlQuery, Transaction> {
+private:
+    QColumns columns;
+    int colId;
+    int colRefAccount;
+    int colAmount;
+    void addColumns();
 public:
-    Reader2Transaction() : DBReader2Object<QSqlQuery, Transaction>(){};
-    Reader2Transaction(Transaction* t) : DBReader2Object<QSqlQuery, Transaction>(t){};
+    Reader2Transaction() : DBReader2Object<QSqlQuery, Transaction>(){addColumns();};
+    Reader2Transaction(Transaction* t) : DBReader2Object<QSqlQuery, Transaction>(t){addColumns();};
+    void begin(QSqlQuery& ds);
     bool read(QSqlQuery& ds);
 };
 
@@ -34,16 +57,21 @@ private:
     Reader2Transaction readTransaction;    
     dbframework::DBReader2STLContainerPtr<QSqlQuery, Transaction, TransactionVector, TransactionPtr> readTransactions;
 public:
-    Reader2AccountWithTrans() : DBReader2Object<QSqlQuery, AccountWithTrans>(){};
-    Reader2AccountWithTrans(AccountWithTrans* a) : DBReader2Object<QSqlQuery, AccountWithTrans>(a){};
+    Reader2AccountWithTrans() : DBReader2Object<QSqlQuery, AccountWithTrans>(){readTransactions.setReader(&readTransaction);};
+    Reader2AccountWithTrans(AccountWithTrans* a) : DBReader2Object<QSqlQuery, AccountWithTrans>(a){readTransactions.setReader(&readTransaction);};
+    void begin(QSqlQuery& ds);
+    void end(QSqlQuery& ds, bool ok);
     bool read(QSqlQuery& ds);
 };
 
 class QKeyReader : public dbframework::DBReader2Object<QSqlQuery, int> {
+private:
+    int index;
 public:
     QString field;
-    QKeyReader() : DBReader2Object<QSqlQuery, int>(){};
-    QKeyReader(int* obj) : DBReader2Object<QSqlQuery, int>(obj){};
+    QKeyReader() : DBReader2Object<QSqlQuery, int>(), index(-1){};
+    QKeyReader(int* obj) : DBReader2Object<QSqlQuery, int>(obj), index(-1){};
+    void begin(QSqlQuery& ds);
     bool read(QSqlQuery& ds);
 };
 
@@ -54,9 +82,12 @@ private:
     QKeyReader readKey;    
     dbframework::DBReader2IndexedSTLContainerPtr<QSqlQuery, AccountWithTrans, AccountWithTransVector,
         int, AccountWithTransPtr, AccountWithTransMap> readAccounts;
+    void setReaders();
 public:
-    Reader2CustomerFullInfo() : DBReader2Object<QSqlQuery, CustomerFullInfo>(){};
-    Reader2CustomerFullInfo(CustomerFullInfo* c) : DBReader2Object<QSqlQuery, CustomerFullInfo>(c){};
+    Reader2CustomerFullInfo() : DBReader2Object<QSqlQuery, CustomerFullInfo>(){setReaders();};
+    Reader2CustomerFullInfo(CustomerFullInfo* c) : DBReader2Object<QSqlQuery, CustomerFullInfo>(c){setReaders();};
+    void begin(QSqlQuery& ds);
+    void end(QSqlQuery& ds, bool ok);
     bool read(QSqlQuery& ds);
 };
 
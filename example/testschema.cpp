@@ -0,0 +1,28 @@
+#include "testschema.h"
+
+const char* scriptDBCreate[] = {
+    "drop table if exists tran",
+
+    "drop table if exists account",
+
+    "drop table if exists customer",
+
+    "create table customer (\
+    id integer primary key,\
+    name text not null)",
+
+    "create table account (\
+    id integer primary key,\
+    ref_customer integer not null,\
+    constraint customer_fk foreign key(ref_customer) references customer(id) \
+    on update restrict on delete restrict)",
+
+    "create table tran (\
+    id integer primary key,\
+    ref_account integer not null,\
+    amount integer not null,\
+    constraint account_fk foreign key(ref_account) references account(id) \
+    on update restrict on delete restrict)",
+
+    nullptr
+};
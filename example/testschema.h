@@ -0,0 +1,7 @@
+#ifndef TESTSCHEMA_H
+#define TESTSCHEMA_H
+
+// Script creating the schema of the example application, terminated by nullptr.
+extern const char* scriptDBCreate[];
+
+#endif // TESTSCHEMA_H
@@ -0,0 +1,38 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*!
+    \file dbsqlite.h
+    The optional sqlite3 adapter of dbframework. It contains the Dataset implementation over the sqlite3 C API
+    (DBSqliteStatement), the matching DBSQLExecutor (DBSqliteExecutor), column readers and typed binders. Values are read and
+    bound without intermediate conversions and text is read as UTF-8.
+
+    The adapter isn't included by dbframework.h. Include sqlite/dbsqlite.h and link with sqlite3 library to use it.
+*/
+
+#ifndef DBSQLITE_H
+#define DBSQLITE_H
+
+#include "dbsqlitestatement.h"
+#include "dbsqliteexec.h"
+#include "dbsqlitereaders.h"
+#include "dbsqlitebinders.h"
+#include "dbsqlitestatistics.h"
+
+#endif // DBSQLITE_H
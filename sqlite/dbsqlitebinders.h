@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSQLITEBINDERS_H
+#define DBSQLITEBINDERS_H
+
+#include "../dbbind.h"
+#include "../dbbindobject.h"
+#include "dbsqlitestatement.h"
+
+namespace dbframework {
+
+/*!
+    The DBSqliteBind template class binds the value of type T to the parameter identified by index using
+    DBSqliteStatement::bindParameter. The value is copied to DBSqliteBind.
+
+    Template parameters.
+
+    T is the type of the value. DBSqliteStatement::bindParameter must be overloaded for T.
+*/
+template <class T>
+class DBSqliteBind : public DBBind<DBSqliteStatement, int, T> {
+private:
+    typedef DBBind<DBSqliteStatement, int, T> AncestorType;
+public:
+    /*!
+        Constructs DBSqliteBind.
+        @param[in] index Parameter index, starting from 1.
+        @param[in] value Parameter value.
+    */
+    DBSqliteBind(int index, const T& value) : AncestorType(index, value) {};
+    /*!
+        Set parameter value.
+        @param[in] value Parameter value.
+    */
+    void setValue(const T& value) {AncestorType::m_value = value;};
+    /*!
+        Binds the value to the parameter.
+        @param[in] dataset Statement which parameter is bound.
+    */
+    void bind(DBSqliteStatement& dataset) {dataset.bindParameter(AncestorType::m_name, AncestorType::m_value);};
+};
+
+/*!
+    The DBSqliteBindVariable template class binds the variable of type T to the parameter identified by index. Unlike
+    DBSqliteBind, the value isn't copied and is read from the variable on every call to bind, so the same binder can be
+    used for many executions. It is the DBBindObject descendant, so it can be used with DBSQLExecutor::execBatch
+    for the range of values.
+
+    Template parameters.
+
+    T is the type of the variable. DBSqliteStatement::bindParameter must be overloaded for T.
+*/
+template <class T>
+class DBSqliteBindVariable : public DBBindObject<DBSqliteStatement, T> {
+private:
+    typedef DBBindObject<DBSqliteStatement, T> AncestorType;
+    int m_index;
+public:
+    /*!
+        Constructs DBSqliteBindVariable.
+        @param[in] index Parameter index, starting from 1.
+        @param[in] variable Pointer to the variable. DBSqliteBindVariable doesn't take ownership of variable.
+    */
+    DBSqliteBindVariable(int index, T* variable = nullptr) : AncestorType(variable), m_index(index) {};
+    /*!
+        Binds the variable value to the parameter.
+        @param[in] dataset Statement which parameter is bound.
+    */
+    void bind(DBSqliteStatement& dataset) {dataset.bindParameter(m_index, *AncestorType::m_object);};
+};
+
+}
+
+#endif // DBSQLITEBINDERS_H
@@ -0,0 +1,135 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSQLITEEXEC_H
+#define DBSQLITEEXEC_H
+
+#include "../dbsqlexec.h"
+#include "dbsqlitestatement.h"
+
+namespace dbframework {
+
+/*!
+    The DBSqliteExecutor class is the DBSQLExecutor implementation for DBSqliteStatement. It executes the statement with
+    sqlite3_step, so the first record of the result is fetched by executeQuery and is returned by the first call to next.
+    Transactions used by execBatch are started and finished on the connection of the statement. The rows of the multi-row
+    query used by execBatch are bound with the parameter index offset of the statement.
+
+    If fetching the record fails, fetchFailed reports it, so exec and other methods of DBSQLExecutor return false for the
+    result truncated by the error. Use DBSqliteStatement::lastResult to get the result code.
+*/
+class DBSqliteExecutor : public DBSQLExecutor<DBSqliteStatement> {
+private:
+    bool execSql(DBSqliteStatement& ds, const char* sql)
+    {
+        return (ds.database() != nullptr) && (sqlite3_exec(ds.database(), sql, nullptr, nullptr, nullptr) == SQLITE_OK);
+    };
+protected:
+    /*!
+        Executes the statement and fetches the first record of the result.
+        @param[in] ds Statement to execute.
+        @return True if success.
+    */
+    bool executeQuery(DBSqliteStatement& ds)
+    {
+        if (!ds.isPrepared())
+            return false;
+
+        ds.reset();
+        ds.m_lastResult = sqlite3_step(ds.m_stmt);
+        if (ds.m_lastResult == SQLITE_ROW) {
+            ds.m_active = true;
+            ds.m_pending = true;
+            return true;
+        }
+        sqlite3_reset(ds.m_stmt);
+        return ds.m_lastResult == SQLITE_DONE;
+    };
+    /*!
+        Makes current the next record of the result. The statement is reset when the end of the result is reached or
+        fetching fails. The result code of sqlite3_step is stored in the statement, see fetchFailed.
+        @param[in] ds Executed statement.
+        @return True if the record was fetched.
+    */
+    bool next(DBSqliteStatement& ds)
+    {
+        if (ds.m_pending) {
+            ds.m_pending = false;
+            return true;
+        }
+        if (!ds.m_active)
+            return false;
+        ds.m_lastResult = sqlite3_step(ds.m_stmt);
+        if (ds.m_lastResult == SQLITE_ROW)
+            return true;
+        ds.reset();
+        return false;
+    };
+    /*!
+        Resets the statement when reading stops before the end of the result, so that its read transaction and locks are
+        released without waiting for the next execution.
+        @param[in] ds Executed statement.
+    */
+    void finishQuery(DBSqliteStatement& ds) {ds.reset();};
+    /*!
+        Checks if the last sqlite3_step call failed.
+        @param[in] ds Executed statement.
+        @return True if fetching the record failed.
+    */
+    bool fetchFailed(DBSqliteStatement& ds) {return ds.failed();};
+    /*!
+        Starts transaction with BEGIN.
+        @param[in] ds Statement used for query execution.
+        @return True if success.
+    */
+    bool beginTransaction(DBSqliteStatement& ds) {return execSql(ds, "BEGIN");};
+    /*!
+        Commits transaction with COMMIT.
+        @param[in] ds Statement used for query execution.
+        @return True if success.
+    */
+    bool commitTransaction(DBSqliteStatement& ds) {return execSql(ds, "COMMIT");};
+    /*!
+        Rolls back transaction with ROLLBACK.
+        @param[in] ds Statement used for query execution.
+        @return True if success.
+    */
+    bool rollbackTransaction(DBSqliteStatement& ds) {return execSql(ds, "ROLLBACK");};
+    /*!
+        Selects the row of the multi-row query by setting the parameter index offset of the statement (see
+        DBSqliteStatement::setParameterOffset), so the binder's indices of every row start from 1. The parameters of the
+        query must be positional, for example generated by DBSQLGeneratorImpl::insert(d, withKeyFields, rowCount).
+        @param[in] ds Statement used for query execution.
+        @param[in] row Zero-based row number.
+        @param[in] rowCount The number of rows in the query.
+        @return True if the number of parameters of the statement is divisible by rowCount.
+    */
+    bool selectBatchRow(DBSqliteStatement& ds, size_t row, size_t rowCount)
+    {
+        size_t count = static_cast<size_t>(ds.parameterCount());
+        if ((rowCount == 0) || (count % rowCount != 0))
+            return false;
+        ds.setParameterOffset(static_cast<int>(row * (count / rowCount)));
+        return true;
+    };
+};
+
+}
+
+#endif // DBSQLITEEXEC_H
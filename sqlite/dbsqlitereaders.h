@@ -0,0 +1,136 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSQLITEREADERS_H
+#define DBSQLITEREADERS_H
+
+#include <string>
+#include "../dbcolumns.h"
+#include "../dbread2object.h"
+#include "dbsqlitestatement.h"
+
+namespace dbframework {
+
+/*!
+    The DBSqliteColumns class is the DBColumns implementation for DBSqliteStatement. Column names are UTF-8 strings.
+*/
+class DBSqliteColumns : public DBColumns<DBSqliteStatement, std::string, int> {
+protected:
+    /*!
+        Get the index of the column using DBSqliteStatement::columnIndex.
+        @param[in] ds Executed statement.
+        @param[in] name Column name.
+        @return Index of the column or -1 if the result has no such column.
+    */
+    int indexOf(DBSqliteStatement& ds, const std::string& name) const {return ds.columnIndex(name);};
+};
+
+/*!
+    The DBSqliteColumnReader template class reads one column of the current record to the variable of type T using
+    DBSqliteStatement::readColumn. The column is identified by index or by name. The name is resolved to index once
+    for every SQL query execution result. DBSqliteColumnReader is useful as the key reader of DBReader2Associative
+    descendants.
+
+    Template parameters.
+
+    T is the type of the variable. DBSqliteStatement::readColumn must be overloaded for T.
+*/
+template <class T>
+class DBSqliteColumnReader : public DBReader2Object<DBSqliteStatement, T> {
+private:
+    typedef DBReader2Object<DBSqliteStatement, T> AncestorType;
+    std::string m_name;
+    int m_column;
+public:
+    /*!
+        Constructs DBSqliteColumnReader that reads the column by index.
+        @param[in] column Column index.
+    */
+    DBSqliteColumnReader(int column = 0) : AncestorType(), m_column(column) {};
+    /*!
+        Constructs DBSqliteColumnReader that reads the column by name.
+        @param[in] name Column name.
+    */
+    DBSqliteColumnReader(const std::string& name) : AncestorType(), m_name(name), m_column(-1) {};
+    /*!
+        Get the index of the column.
+        @return Index of the column or -1 if the column name wasn't resolved.
+    */
+    int column() const {return m_column;};
+    /*!
+        Resolves the column name to index if the column is identified by name.
+        @param[in] ds Executed statement.
+    */
+    void begin(DBSqliteStatement& ds)
+    {
+        if (!m_name.empty())
+            m_column = ds.columnIndex(m_name);
+    };
+    /*!
+        Reads the column to the assosiated variable.
+        @param[in] ds Executed statement.
+        @return False if the column wasn't found.
+    */
+    bool read(DBSqliteStatement& ds)
+    {
+        if ((AncestorType::m_object == nullptr) || (m_column < 0))
+            return false;
+
+        ds.readColumn(m_column, *AncestorType::m_object);
+        return true;
+    };
+};
+
+/*!
+    The DBSqliteNullReader class reads the flag that shows whether the column of the current record is NULL. The column is
+    identified like in DBSqliteColumnReader. DBSqliteNullReader is used as the null reader of DBColumnarColumn and
+    DBReader2Aggregate and as the null key reader of DBReader2FlatLevel.
+*/
+class DBSqliteNullReader : public DBSqliteColumnReader<bool> {
+private:
+    typedef DBSqliteColumnReader<bool> AncestorType;
+public:
+    /*!
+        Constructs DBSqliteNullReader that reads the flag for the column identified by index.
+        @param[in] column Column index.
+    */
+    DBSqliteNullReader(int column = 0) : AncestorType(column) {};
+    /*!
+        Constructs DBSqliteNullReader that reads the flag for the column identified by name.
+        @param[in] name Column name.
+    */
+    DBSqliteNullReader(const std::string& name) : AncestorType(name) {};
+    /*!
+        Reads the flag using DBSqliteStatement::isNull.
+        @param[in] ds Executed statement.
+        @return False if the column wasn't found.
+    */
+    bool read(DBSqliteStatement& ds)
+    {
+        if ((m_object == nullptr) || (column() < 0))
+            return false;
+
+        *m_object = ds.isNull(column());
+        return true;
+    };
+};
+
+}
+
+#endif // DBSQLITEREADERS_H
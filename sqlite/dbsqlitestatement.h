@@ -0,0 +1,344 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSQLITESTATEMENT_H
+#define DBSQLITESTATEMENT_H
+
+#include <string>
+#include <sqlite3.h>
+
+namespace dbframework {
+
+class DBSqliteExecutor;
+
+/*!
+    The DBSqliteStatement class is the Dataset implementation over the sqlite3 C API. It owns prepared sqlite3 statement
+    and provides typed access to the columns of the current record and typed parameter binding without intermediate
+    conversions. Text is read and bound as UTF-8. Use DBSqliteExecutor to execute DBSqliteStatement.
+
+    Columns are numbered from 0 and parameters are numbered from 1, as in sqlite3 C API. Values of the current record are
+    valid until the next record is fetched.
+
+    Binding a parameter of the statement that was executed and wasn't reset resets it first, so the same
+    DBSqliteStatement instance can be executed many times with different parameters.
+*/
+class DBSqliteStatement {
+private:
+    sqlite3_stmt* m_stmt;
+    bool m_active;
+    bool m_pending;
+    int m_lastResult;
+    int m_parameterOffset;
+
+    friend class DBSqliteExecutor;
+
+    DBSqliteStatement(const DBSqliteStatement&) = delete;
+    DBSqliteStatement& operator=(const DBSqliteStatement&) = delete;
+public:
+    /*!
+        Constructs DBSqliteStatement without prepared statement.
+    */
+    DBSqliteStatement() : m_stmt(nullptr), m_active(false), m_pending(false), m_lastResult(SQLITE_OK),
+        m_parameterOffset(0) {};
+    /*!
+        Constructs DBSqliteStatement and prepares SQL query. Use isPrepared to check the result.
+        @param[in] db sqlite3 connection.
+        @param[in] sql SQL query text in UTF-8.
+    */
+    DBSqliteStatement(sqlite3* db, const std::string& sql) : m_stmt(nullptr), m_active(false), m_pending(false),
+        m_lastResult(SQLITE_OK), m_parameterOffset(0)
+    {
+        prepare(db, sql);
+    };
+    /*!
+        Destroys DBSqliteStatement and finalizes the prepared statement.
+    */
+    ~DBSqliteStatement()
+    {
+        sqlite3_finalize(m_stmt);
+    };
+    /*!
+        Prepares SQL query. Previously prepared statement is finalized.
+        @param[in] db sqlite3 connection.
+        @param[in] sql SQL query text in UTF-8.
+        @return True if success.
+    */
+    bool prepare(sqlite3* db, const std::string& sql)
+    {
+        sqlite3_finalize(m_stmt);
+        m_stmt = nullptr;
+        m_active = false;
+        m_pending = false;
+        m_parameterOffset = 0;
+        m_lastResult = sqlite3_prepare_v2(db, sql.c_str(), static_cast<int>(sql.size() + 1), &m_stmt, nullptr);
+        return m_lastResult == SQLITE_OK;
+    };
+    /*!
+        Check if the statement was successfully prepared.
+        @return True if the statement is prepared.
+    */
+    bool isPrepared() const {return m_stmt != nullptr;};
+    /*!
+        Get sqlite3 statement handle.
+        @return sqlite3 statement handle or nullptr if the statement isn't prepared.
+    */
+    sqlite3_stmt* handle() {return m_stmt;};
+    /*!
+        Get SQL query text of the statement. Can be used to identify the statement in DBSQLExecObserver.
+        @return SQL query text in UTF-8 or empty string if the statement isn't prepared.
+    */
+    const char* sql() {return (m_stmt != nullptr) ? sqlite3_sql(m_stmt) : "";};
+    /*!
+        Get sqlite3 connection of the statement.
+        @return sqlite3 connection or nullptr if the statement isn't prepared.
+    */
+    sqlite3* database() {return (m_stmt != nullptr) ? sqlite3_db_handle(m_stmt) : nullptr;};
+    /*!
+        Get the error message of the last failed sqlite3 API call for the connection of the statement.
+        @return Error message in UTF-8.
+    */
+    const char* errorMessage() {return (m_stmt != nullptr) ? sqlite3_errmsg(database()) : "statement isn't prepared";};
+    /*!
+        Get the result code of the last sqlite3_step call made by DBSqliteExecutor for the statement, or of prepare if the
+        statement wasn't executed since it was prepared.
+        @return sqlite3 result code, for example SQLITE_ROW, SQLITE_DONE or SQLITE_BUSY.
+    */
+    int lastResult() const {return m_lastResult;};
+    /*!
+        Check if the last execution of the statement failed, for example with SQLITE_BUSY, SQLITE_IOERR or SQLITE_CORRUPT.
+        DBSqliteExecutor uses it to report the failure of fetching the record, see DBSQLExecutor::fetchFailed.
+        @return True if the last sqlite3_step or prepare call returned error code.
+    */
+    bool failed() const {return (m_lastResult != SQLITE_OK) && (m_lastResult != SQLITE_ROW) && (m_lastResult != SQLITE_DONE);};
+    /*!
+        Resets the statement if it was executed. Parameter values are kept.
+    */
+    void reset()
+    {
+        if (m_active) {
+            sqlite3_reset(m_stmt);
+            m_active = false;
+            m_pending = false;
+        }
+    };
+    /*!
+        Get the number of columns in the SQL query result.
+        @return The number of columns.
+    */
+    int columnCount() {return sqlite3_column_count(m_stmt);};
+    /*!
+        Get the index of the column by its name.
+        @param[in] name Column name in UTF-8.
+        @return Index of the column or -1 if the result has no such column.
+    */
+    int columnIndex(const std::string& name)
+    {
+        int count = columnCount();
+        for (int i = 0; i < count; ++i) {
+            const char* columnName = sqlite3_column_name(m_stmt, i);
+            if ((columnName != nullptr) && (name == columnName))
+                return i;
+        }
+        return -1;
+    };
+    /*!
+        Check if the column of the current record is NULL.
+        @param[in] column Column index.
+        @return True if the value is NULL.
+    */
+    bool isNull(int column) {return sqlite3_column_type(m_stmt, column) == SQLITE_NULL;};
+    /*!
+        Get the text of the column of the current record without copying it.
+        @param[in] column Column index.
+        @param[out] size Length of the text in bytes.
+        @return Pointer to UTF-8 text or nullptr if the value is NULL. Pointer is valid until the next record is fetched.
+    */
+    const char* columnText(int column, int& size)
+    {
+        const char* text = reinterpret_cast<const char*>(sqlite3_column_text(m_stmt, column));
+        size = sqlite3_column_bytes(m_stmt, column);
+        return text;
+    };
+    /*!
+        Reads the column of the current record. NULL is read as zero.
+        @param[in] column Column index.
+        @param[out] value Column value.
+    */
+    void readColumn(int column, int& value) {value = sqlite3_column_int(m_stmt, column);};
+    /*!
+        Reads the column of the current record. NULL is read as zero.
+        @param[in] column Column index.
+        @param[out] value Column value.
+    */
+    void readColumn(int column, long& value) {value = static_cast<long>(sqlite3_column_int64(m_stmt, column));};
+    /*!
+        Reads the column of the current record. NULL is read as zero.
+        @param[in] column Column index.
+        @param[out] value Column value.
+    */
+    void readColumn(int column, long long& value) {value = sqlite3_column_int64(m_stmt, column);};
+    /*!
+        Reads the column of the current record. NULL is read as zero.
+        @param[in] column Column index.
+        @param[out] value Column value.
+    */
+    void readColumn(int column, bool& value) {value = sqlite3_column_int(m_stmt, column) != 0;};
+    /*!
+        Reads the column of the current record. NULL is read as zero.
+        @param[in] column Column index.
+        @param[out] value Column value.
+    */
+    void readColumn(int column, double& value) {value = sqlite3_column_double(m_stmt, column);};
+    /*!
+        Reads the column of the current record as UTF-8 text. NULL is read as empty string.
+        @param[in] column Column index.
+        @param[out] value Column value.
+    */
+    void readColumn(int column, std::string& value)
+    {
+        int size;
+        const char* text = columnText(column, size);
+        if (text != nullptr)
+            value.assign(text, size);
+        else
+            value.clear();
+    };
+    /*!
+        Get the index of the parameter by its name.
+        @param[in] name Parameter name including prefix, for example ":id".
+        @return Index of the parameter or 0 if the statement has no such parameter.
+    */
+    int parameterIndex(const std::string& name) {return sqlite3_bind_parameter_index(m_stmt, name.c_str());};
+    /*!
+        Get the number of parameters of the statement.
+        @return The largest parameter index.
+    */
+    int parameterCount() {return sqlite3_bind_parameter_count(m_stmt);};
+    /*!
+        Get the offset added to the parameter index by the bind methods.
+        @return Parameter index offset.
+    */
+    int parameterOffset() const {return m_parameterOffset;};
+    /*!
+        Set the offset added to the parameter index by the bind methods. DBSqliteExecutor uses it to bind the rows of the
+        multi-row query with the binder that binds one row (see DBSQLExecutor::execBatch), so the binder's indices start
+        from 1 for every row. Default offset is zero.
+        @param[in] offset Parameter index offset.
+    */
+    void setParameterOffset(int offset) {m_parameterOffset = offset;};
+    /*!
+        Binds NULL to the parameter.
+        @param[in] index Parameter index.
+        @return True if success.
+    */
+    bool bindNull(int index)
+    {
+        reset();
+        return sqlite3_bind_null(m_stmt, m_parameterOffset + index) == SQLITE_OK;
+    };
+    /*!
+        Binds value to the parameter.
+        @param[in] index Parameter index.
+        @param[in] value Parameter value.
+        @return True if success.
+    */
+    bool bindParameter(int index, int value)
+    {
+        reset();
+        return sqlite3_bind_int(m_stmt, m_parameterOffset + index, value) == SQLITE_OK;
+    };
+    /*!
+        Binds value to the parameter.
+        @param[in] index Parameter index.
+        @param[in] value Parameter value.
+        @return True if success.
+    */
+    bool bindParameter(int index, long value)
+    {
+        return bindParameter(index, static_cast<long long>(value));
+    };
+    /*!
+        Binds value to the parameter.
+        @param[in] index Parameter index.
+        @param[in] value Parameter value.
+        @return True if success.
+    */
+    bool bindParameter(int index, long long value)
+    {
+        reset();
+        return sqlite3_bind_int64(m_stmt, m_parameterOffset + index, value) == SQLITE_OK;
+    };
+    /*!
+        Binds value to the parameter as integer 0 or 1.
+        @param[in] index Parameter index.
+        @param[in] value Parameter value.
+        @return True if success.
+    */
+    bool bindParameter(int index, bool value)
+    {
+        return bindParameter(index, value ? 1 : 0);
+    };
+    /*!
+        Binds value to the parameter.
+        @param[in] index Parameter index.
+        @param[in] value Parameter value.
+        @return True if success.
+    */
+    bool bindParameter(int index, double value)
+    {
+        reset();
+        return sqlite3_bind_double(m_stmt, m_parameterOffset + index, value) == SQLITE_OK;
+    };
+    /*!
+        Binds UTF-8 text to the parameter. The text is copied by sqlite.
+        @param[in] index Parameter index.
+        @param[in] value Parameter value.
+        @return True if success.
+    */
+    bool bindParameter(int index, const std::string& value)
+    {
+        reset();
+        return sqlite3_bind_text(m_stmt, m_parameterOffset + index, value.data(), static_cast<int>(value.size()), SQLITE_TRANSIENT) == SQLITE_OK;
+    };
+    /*!
+        Binds UTF-8 text to the parameter without copying it. The text must remain valid until the parameter is rebound or
+        the statement is destroyed.
+        @param[in] index Parameter index.
+        @param[in] text Pointer to UTF-8 text. If nullptr, NULL is bound.
+        @param[in] size Length of the text in bytes or -1 if the text is null-terminated.
+        @return True if success.
+    */
+    bool bindStaticText(int index, const char* text, int size = -1)
+    {
+        reset();
+        return sqlite3_bind_text(m_stmt, m_parameterOffset + index, text, size, SQLITE_STATIC) == SQLITE_OK;
+    };
+    /*!
+        Sets all parameters to NULL.
+    */
+    void clearBindings()
+    {
+        reset();
+        sqlite3_clear_bindings(m_stmt);
+    };
+};
+
+}
+
+#endif // DBSQLITESTATEMENT_H
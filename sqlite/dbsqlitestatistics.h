@@ -0,0 +1,45 @@
+/*
+Copyright (c) 2017 Sidorov Dmitry
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DBSQLITESTATISTICS_H
+#define DBSQLITESTATISTICS_H
+
+#include <string>
+#include "../dbsqlstatistics.h"
+#include "dbsqlitestatement.h"
+
+namespace dbframework {
+
+/*!
+    The DBSqliteStatistics class is the DBSQLStatistics implementation for DBSqliteStatement. Statements are identified by
+    their SQL query text.
+*/
+class DBSqliteStatistics : public DBSQLStatistics<DBSqliteStatement> {
+protected:
+    /*!
+        Get SQL query text using DBSqliteStatement::sql.
+        @param[in] ds Statement used for query execution.
+        @return SQL query text.
+    */
+    std::string sqlText(DBSqliteStatement& ds) {return ds.sql();};
+};
+
+}
+
+#endif // DBSQLITESTATISTICS_H